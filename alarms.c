@@ -0,0 +1,125 @@
+#include "alarms.h"
+
+#include <furi.h>
+#include <storage/storage.h>
+
+// File layout: "BA", version, reserved, count (u16 LE), then count Alarms.
+#define ALARMS_FILE    APP_DATA_PATH("alarms.bin")
+#define ALARMS_VERSION 1
+
+typedef struct {
+    char magic[2];
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t count;
+} AlarmsHeader;
+
+static bool alarm_valid(const Alarm* a) {
+    return a->hour < 24 && a->minute < 60;
+}
+
+void alarms_load(Alarms* al) {
+    al->items = NULL;
+    al->count = 0;
+    al->next = ALARM_NONE;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* f = storage_file_alloc(storage);
+
+    FuriString* path = furi_string_alloc_set(ALARMS_FILE);
+    storage_common_resolve_path_and_ensure_app_directory(storage, path);
+
+    if(storage_file_open(f, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+        AlarmsHeader hdr;
+        if(storage_file_read(f, &hdr, sizeof(hdr)) == sizeof(hdr) && hdr.magic[0] == 'B' &&
+           hdr.magic[1] == 'A' && hdr.version == ALARMS_VERSION && hdr.count <= ALARMS_MAX) {
+            const size_t size = hdr.count * sizeof(Alarm);
+            al->items = malloc(size ? size : sizeof(Alarm));
+            if(storage_file_read(f, al->items, size) == size) {
+                // Keep only the records with a real time of day: a corrupt one
+                // would otherwise be scheduled (alarm_next) at a bogus time.
+                for(uint16_t i = 0; i < hdr.count; i++) {
+                    if(alarm_valid(&al->items[i])) al->items[al->count++] = al->items[i];
+                }
+            }
+        }
+        storage_file_close(f);
+    }
+
+    furi_string_free(path);
+    storage_file_free(f);
+    furi_record_close(RECORD_STORAGE);
+}
+
+void alarms_save(const Alarms* al) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* f = storage_file_alloc(storage);
+
+    FuriString* path = furi_string_alloc_set(ALARMS_FILE);
+    storage_common_resolve_path_and_ensure_app_directory(storage, path);
+
+    if(storage_file_open(f, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        AlarmsHeader hdr = {{'B', 'A'}, ALARMS_VERSION, 0, al->count};
+        storage_file_write(f, &hdr, sizeof(hdr));
+        storage_file_write(f, al->items, al->count * sizeof(Alarm));
+        storage_file_close(f);
+    }
+
+    furi_string_free(path);
+    storage_file_free(f);
+    furi_record_close(RECORD_STORAGE);
+}
+
+void alarms_free(Alarms* al) {
+    free(al->items);
+    al->items = NULL;
+    al->count = 0;
+}
+
+bool alarms_set(Alarms* al, uint16_t i, const Alarm* a, uint32_t now) {
+    if(i > al->count || !alarm_valid(a)) return false;
+
+    if(i == al->count) {
+        if(al->count >= ALARMS_MAX) return false;
+        al->items = realloc(al->items, (al->count + 1) * sizeof(Alarm));
+        al->count++;
+    }
+    al->items[i] = *a;
+
+    alarms_schedule(al, now);
+    return true;
+}
+
+void alarms_delete(Alarms* al, uint16_t i, uint32_t now) {
+    if(i >= al->count) return;
+
+    memmove(&al->items[i], &al->items[i + 1], (al->count - i - 1) * sizeof(Alarm));
+    al->count--;
+    alarms_schedule(al, now);
+}
+
+uint32_t alarm_next(const Alarm* a, uint32_t now) {
+    if(!(a->flags & ALARM_ENABLED) || !(a->days & ALARM_DAYS_ALL)) return ALARM_NONE;
+
+    const uint32_t day = now / 86400;
+    const uint32_t sod = now % 86400;
+    const uint32_t at = a->hour * 3600UL + a->minute * 60UL;
+
+    // Today (if still ahead) or one of the next 7 days. Day 0 of the epoch,
+    // 1970-01-01, was a Thursday, hence the +3 to make Monday bit 0.
+    for(uint32_t d = 0; d <= 7; d++) {
+        if(d == 0 && at <= sod) continue;
+        const uint32_t wd = (day + d + 3) % 7;
+        if(a->days & (1 << wd)) return (day + d) * 86400 + at;
+    }
+    return ALARM_NONE;
+}
+
+void alarms_schedule(Alarms* al, uint32_t now) {
+    uint32_t next = ALARM_NONE;
+    for(uint16_t i = 0; i < al->count; i++) {
+        const uint32_t t = alarm_next(&al->items[i], now);
+        if(t < next) next = t;
+    }
+    al->next = next;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Alarms
+// ----------------------------------------------------------------------------
+//
+// Any number of alarms, kept in one compact binary file. The app never scans
+// the list per tick: alarms_schedule() precomputes the earliest firing time,
+// and the tick only compares the current RTC timestamp against it. The list is
+// rescheduled when an alarm fires or the list changes.
+//
+// Times are RTC timestamps (seconds, local time, like furi_hal_rtc_get_timestamp).
+//
+#define ALARM_ENABLED  (1 << 0)   // Alarm.flags
+#define ALARM_DAYS_ALL 0x7F       // Alarm.days: bit 0 = Monday .. bit 6 = Sunday
+#define ALARM_NONE     UINT32_MAX // no firing time
+#define ALARMS_MAX     1024
+
+// One alarm, stored as-is in the file (4 bytes).
+typedef struct {
+    uint8_t hour;     // 0..23
+    uint8_t minute;   // 0..59
+    uint8_t days;     // weekday mask
+    uint8_t flags;
+} Alarm;
+
+typedef struct {
+    Alarm* items;
+    uint16_t count;
+    uint32_t next;    // earliest firing time of any enabled alarm, or ALARM_NONE
+} Alarms;
+
+// Load the list from the app data directory (empty if missing or invalid;
+// records with an hour >= 24 or a minute >= 60 are dropped).
+void alarms_load(Alarms* al);
+
+// Write the whole list in one go.
+void alarms_save(const Alarms* al);
+
+void alarms_free(Alarms* al);
+
+// Replace alarm i, or append when i == count. Reschedules. False if full or
+// the time is out of range.
+bool alarms_set(Alarms* al, uint16_t i, const Alarm* a, uint32_t now);
+
+// Remove alarm i; the later ones move down one. Reschedules.
+void alarms_delete(Alarms* al, uint16_t i, uint32_t now);
+
+// Next firing time of one alarm strictly after `now`, or ALARM_NONE.
+uint32_t alarm_next(const Alarm* a, uint32_t now);
+
+// Recompute al->next from `now`. O(count); only on fire or list change.
+void alarms_schedule(Alarms* al, uint32_t now);
+
+// The per-tick check: a single compare.
+static inline bool alarms_due(const Alarms* al, uint32_t now) {
+    return now >= al->next;
+}
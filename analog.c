@@ -0,0 +1,198 @@
+#include "analog.h"
+#include "layout.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Dial geometry (layout.h): centered in the area left of the gutter.
+#define CX DIAL_CX
+#define CY DIAL_CY
+#define R  DIAL_R
+
+// sin(i * 6 deg) in Q14, i = 0..59. cos(i) = sin(i + 15).
+static const int16_t sin60[60] = {
+         0,   1713,   3406,   5063,   6664,   8192,   9630,  10963,
+     12176,  13255,  14189,  14968,  15582,  16026,  16294,  16384,
+     16294,  16026,  15582,  14968,  14189,  13255,  12176,  10963,
+      9630,   8192,   6664,   5063,   3406,   1713,      0,  -1713,
+     -3406,  -5063,  -6664,  -8192,  -9630, -10963, -12176, -13255,
+    -14189, -14968, -15582, -16026, -16294, -16384, -16294, -16026,
+    -15582, -14968, -14189, -13255, -12176, -10963,  -9630,  -8192,
+     -6664,  -5063,  -3406,  -1713,
+};
+
+// Point at radius r (px) and position i (60ths of a turn, 0 = 12 o'clock).
+// Rounded to nearest: adding half a unit before the arithmetic shift.
+static int pt_x(int i, int r) {
+    return CX + ((r * sin60[i % 60] + (1 << 13)) >> 14);
+}
+
+static int pt_y(int i, int r) {
+    return CY - ((r * sin60[(i + 15) % 60] + (1 << 13)) >> 14);
+}
+
+typedef struct {
+    uint8_t len;     // px from the center
+    uint8_t thick;   // 1..3 px
+} Hand;
+
+static const Hand hand_hour = {DIAL_LEN(16), 3};
+static const Hand hand_minute = {DIAL_LEN(25), 2};
+static const Hand hand_second = {DIAL_LEN(28), 1};
+
+// Draw a hand at position i. Thickness comes from parallel lines offset
+// across the hand's main direction.
+static void hand_line(Frame* f, const Hand* hand, int i) {
+    const int x1 = pt_x(i, hand->len);
+    const int y1 = pt_y(i, hand->len);
+    const int dx = x1 - CX;
+    const int dy = y1 - CY;
+    const bool steep = (dy < 0 ? -dy : dy) > (dx < 0 ? -dx : dx);
+
+    for(int k = 0; k < hand->thick; k++) {
+        // Offsets 0, +1, -1 across the hand.
+        const int o = (k == 0) ? 0 : (k == 1 ? 1 : -1);
+        const int ox = steep ? o : 0;
+        const int oy = steep ? 0 : o;
+        frame_line(f, CX + ox, CY + oy, x1 + ox, y1 + oy);
+    }
+}
+
+void analog_dial(Frame* bg) {
+    frame_clear(bg);
+
+    // Ring: midpoint circle, one px wide.
+    int x = R;
+    int y = 0;
+    int err = 1 - R;
+    while(x >= y) {
+        const int px[8] = {x, y, -y, -x, -x, -y, y, x};
+        const int py[8] = {y, x, x, y, -y, -x, -x, -y};
+        for(int k = 0; k < 8; k++) frame_box(bg, CX + px[k], CY + py[k], 1, 1, true);
+        y++;
+        if(err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+
+    // Minute dots, hour marks (heavier at 12, 3, 6 and 9).
+    for(int i = 0; i < 60; i++) {
+        if(i % 5) {
+            frame_box(bg, pt_x(i, R - DIAL_LEN(2)), pt_y(i, R - DIAL_LEN(2)), 1, 1, true);
+        } else {
+            const int inner = R - DIAL_LEN((i % 15) ? 6 : 8);
+            const int outer = R - DIAL_LEN(2);
+            frame_line(bg, pt_x(i, inner), pt_y(i, inner), pt_x(i, outer), pt_y(i, outer));
+        }
+    }
+}
+
+void analog_draw(Frame* f, const Frame* dial, int h, int m, int s) {
+    frame_copy(f, dial);
+    hand_line(f, &hand_hour, h);
+    hand_line(f, &hand_minute, m);
+    if(s >= 0) hand_line(f, &hand_second, s);
+    frame_box(f, CX - 1, CY - 1, 3, 3, true);
+}
+
+// ----------------------------------------------------------------------------
+// ClockFace
+// ----------------------------------------------------------------------------
+
+// Hand positions in 60ths of a turn, -1 = hidden (seconds only).
+typedef struct {
+    int8_t h, m, s;
+} Hands;
+
+typedef struct {
+    Frame* dial;        // background, rendered on the first render
+    Hands want;         // hands for the last Readout
+    bool drawn;         // the frame holds want
+    bool fresh;         // no Readout yet
+} AnalogFace;
+
+// Box around a hand at position i, the center dot and thickness included.
+static FaceRect hand_rect(const Hand* hand, int i) {
+    const int x = pt_x(i, hand->len);
+    const int y = pt_y(i, hand->len);
+    const int x0 = (x < CX ? x : CX) - 1;
+    const int y0 = (y < CY ? y : CY) - 1;
+    const int x1 = (x > CX ? x : CX) + 1;
+    const int y1 = (y > CY ? y : CY) + 1;
+    return (FaceRect){(uint8_t)x0, (uint8_t)y0, (uint8_t)(x1 - x0 + 1), (uint8_t)(y1 - y0 + 1)};
+}
+
+static void* analog_init(void) {
+    AnalogFace* a = malloc(sizeof(AnalogFace));
+    memset(a, 0, sizeof(AnalogFace));
+    a->fresh = true;
+    return a;
+}
+
+static void analog_deinit(void* face) {
+    AnalogFace* a = face;
+    free(a->dial);
+    free(a);
+}
+
+static int analog_on_tick(void* face, const Readout* r, FaceRect* damage, uint8_t* next_s) {
+    AnalogFace* a = face;
+
+    // Hands in 60ths of a turn, from the readout's digits; the hour hand
+    // steps every 12 minutes.
+    const int hour = (r->big[0] > 0 ? r->big[0] : 0) * 10 + r->big[1];
+    const int minute = r->big[2] * 10 + r->big[3];
+    const bool secs = r->small && r->small_digit[0] >= 0;
+    const Hands want = {
+        (int8_t)((hour % 12) * 5 + minute / 12),
+        (int8_t)minute,
+        (int8_t)(secs ? r->small_digit[0] * 10 + r->small_digit[1] : -1),
+    };
+    *next_s = secs ? 1 : r->minute_s;
+
+    int n = 0;
+    if(a->fresh) {
+        damage[n++] = face_screen;
+    } else {
+        const Hand* const hands[3] = {&hand_hour, &hand_minute, &hand_second};
+        const int8_t from[3] = {a->want.h, a->want.m, a->want.s};
+        const int8_t to[3] = {want.h, want.m, want.s};
+        for(int k = 0; k < 3; k++) {
+            if(from[k] == to[k]) continue;
+            if(from[k] >= 0) damage[n++] = hand_rect(hands[k], from[k]);
+            if(to[k] >= 0) damage[n++] = hand_rect(hands[k], to[k]);
+        }
+    }
+
+    a->want = want;
+    if(n) a->drawn = false;
+    a->fresh = false;
+    return n;
+}
+
+static void analog_render(void* face, Frame* f, const FaceRect* region) {
+    AnalogFace* a = face;
+
+    // Every rectangle reported is a hand that moved; the first call redraws
+    // the whole frame and the rest find nothing left to do.
+    const bool full = region->w == FRAME_W && region->h == FRAME_H;
+    if(a->drawn && !full) return;
+    if(!a->dial) {
+        a->dial = malloc(sizeof(Frame));
+        analog_dial(a->dial);
+    }
+    analog_draw(f, a->dial, a->want.h, a->want.m, a->want.s);
+    a->drawn = true;
+}
+
+const ClockFace analog_face = {
+    .init = analog_init,
+    .deinit = analog_deinit,
+    .on_tick = analog_on_tick,
+    .render = analog_render,
+};
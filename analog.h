@@ -0,0 +1,26 @@
+#pragma once
+
+#include "face.h"
+#include "frame.h"
+
+// ----------------------------------------------------------------------------
+// Analog face
+// ----------------------------------------------------------------------------
+//
+// Hand endpoints come from a 60-entry fixed-point sine table (no floats, no
+// libm) and are drawn with integer Bresenham lines. The dial is rendered once
+// into a background Frame; every frame copies it in and draws all the hands
+// (README, "Inverted display", for why not erase just the moved ones).
+//
+
+// Render the dial (ring, minute dots, hour marks) into bg.
+void analog_dial(Frame* bg);
+
+// f = dial with the hands at h/m/s, in 60ths of a turn (s < 0 hides the
+// seconds hand).
+void analog_draw(Frame* f, const Frame* dial, int h, int m, int s);
+
+// The analog face (face.h). Damage is the box around each hand that moved,
+// old and new position, so unmoved seconds skip the redraw; the dial Frame is
+// rendered on the first render.
+extern const ClockFace analog_face;
@@ -1,5 +1,6 @@
 #include <furi.h>
 #include <furi_hal_rtc.h>
+#include <furi_hal_power.h>
 
 #include <gui/gui.h>
 #include <gui/canvas.h>
@@ -12,6 +13,32 @@
 
 #include <storage/storage.h>
 
+#include <stdio.h>
+
+#include "frame.h"
+#include "stopwatch.h"
+#include "countdown.h"
+#include "chess.h"
+#include "alarms.h"
+#include "analog.h"
+#include "binary.h"
+#include "datepage.h"
+#include "tz.h"
+#include "sun.h"
+#include "sunpage.h"
+#include "portraitface.h"
+#include "face.h"
+#include "glyphs.h"
+#include "layout.h"
+#include "clockmodel.h"
+#include "laps.h"
+#include "interval.h"
+#include "segface.h"
+#include "settings.h"
+#include "tick.h"
+
+#define TAG "BigClock"
+
 // ----------------------------------------------------------------------------
 // App state
 // ----------------------------------------------------------------------------
@@ -21,19 +48,289 @@
 // - A message queue moves input events from the callback into the main loop.
 // - A periodic timer triggers redraws (once per second here).
 // - NotificationApp is used only to force the backlight to stay on while running.
+// - An offscreen Frame keeps the last rendered image so a redraw only rewrites
+//   the cells whose value changed (see "Draw callback").
 //
+
+// What the big digits are showing. UP/DOWN long press cycles through these.
+typedef enum {
+    ModeClock,
+    ModeStopwatch,
+    ModeCountdown,
+    ModeChess,
+    ModeInterval,
+    ModeCount,
+} Mode;
+
+// Clock face. DOWN cycles through these in clock mode.
+typedef enum {
+    FaceDigital,
+    FaceAnalog,
+    FaceBinary,
+    FaceCount,
+} Face;
+
+// Clock mode pages. LEFT/RIGHT step through these; not saved.
+typedef enum {
+    PageTime,
+    PageDate,
+    PageSun,
+    PageZone,   // first world clock page, one per zone in zones.txt
+} Page;
+
+typedef enum {
+    ChimeOff,
+    ChimeHourly,
+    ChimeQuarter,    // every 15 minutes, longer on the hour
+    ChimeCount,
+} Chime;
+
+// Backlight policy. LEFT long cycles through these in clock mode.
+typedef enum {
+    BacklightOn,        // full level while the app runs
+    BacklightNightDim,  // dim_level inside the dimming hours
+    BacklightOff,       // off; a key press lights it for light_secs
+    BacklightCount,
+} Backlight;
+
+// Battery governor level, from a once-a-minute battery sample. Each step
+// down is cheaper: Low redraws the clock once a minute without seconds and
+// caps the backlight at dim_level, Critical also turns the backlight off
+// (a key press still wakes it).
+typedef enum {
+    PowerNormal,
+    PowerLow,        // <= POWER_LOW_PCT and not charging
+    PowerCritical,   // <= POWER_CRITICAL_PCT and not charging
+    PowerCount,
+} Power;
+
+// Enter at the threshold, leave POWER_HYSTERESIS points above it, so the
+// level doesn't flap around one percentage.
+#define POWER_LOW_PCT      20
+#define POWER_CRITICAL_PCT 10
+#define POWER_HYSTERESIS   5
+
+// Stopwatch refresh cap while running (settings menu). The recorded times are
+// exact either way; this only limits how often the display catches up.
+#define STOPWATCH_FPS_DEFAULT 10
+#define STOPWATCH_FPS_MAX     50
+
+#define COUNTDOWN_PRESET_DEFAULT (5 * 60) // seconds
+#define CHESS_BASE_DEFAULT       (5 * 60) // seconds per side
+#define INTERVAL_WORK_DEFAULT    (25 * 60) // seconds
+#define INTERVAL_REST_DEFAULT    (5 * 60)  // seconds
+#define INTERVAL_CYCLES_DEFAULT  4
+
+// Draw cost counters, logged once a minute (debug log level).
+typedef struct {
+    uint32_t frames;       // draw_cb calls this minute
+    uint32_t skipped;      // redraws not asked for: the face reported no damage
+    uint32_t px_partial;   // pixels written by incremental redraws this minute
+    uint32_t px_full;      // pixels written by the most recent full redraw
+    uint32_t input_lag;    // worst press-to-handled delay this minute, in ticks
+    uint32_t chess_lag;    // worst press-to-charged delay of a chess switch, in ticks
+    uint32_t chess_switches; // chess switches recorded this minute
+    uint32_t chimes;       // chimes played this minute
+    uint32_t redraw_req;   // tick the last periodic redraw was requested
+    bool redraw_pending;   // redraw_req not yet drawn
+    bool redraw_chime;     // ...and it is the redraw of a chime slot
+    uint32_t lat_chime;    // worst request-to-drawn delay at a chime slot, in ticks
+    uint32_t lat_other;    // worst request-to-drawn delay otherwise, in ticks
+    int minute;            // minute the counters belong to
+    uint8_t layout;        // layout_key of the frames counted (mode, face, flags)
+    uint32_t power_secs[PowerCount]; // time spent at each governor level (since start)
+    uint32_t power_changes;  // governor level changes (since start)
+    uint32_t power_since;    // RTC timestamp of the last level change
+    uint32_t start_tick;     // tick at entry...
+    size_t start_heap;       // ...and free heap then
+    bool started;            // first frame drawn (startup logged)
+    uint32_t power_logged;   // power_changes when the power line was last logged
+    uint32_t glyph_hits;     // glyph cache hits when it was last logged
+    uint32_t glyph_misses;   // glyph cache misses when it was last logged
+    ClockModel* model;       // its hit counters are logged and reset with these
+} Perf;
+
+typedef enum {
+    AppEventInput,   // key event from input_cb
+    AppEventTick,    // periodic timer: time to ask the face what changed
+    AppEventWake,    // one-shot wake timer fired
+    AppEventLight,   // a key press woke the backlight (BacklightOff)
+    AppEventDark,    // the backlight's time ran out (BacklightOff)
+} AppEventType;
+
+// File writes a handler asks for. They are done by flush_pending once the main
+// loop has let go of the mutex: the state is snapshotted under it and the
+// (slow) storage write happens without it, so draw_cb never waits on a save.
+// Only the load at entry and the saves at exit touch storage directly.
+typedef enum {
+    PendingInterval = 1 << 0,  // save the interval timer
+    PendingLaps = 1 << 1,      // export the laps, and say whether that worked...
+    PendingLapsReset = 1 << 2, // ...or reset the stopwatch if it did
+    PendingSettings = 1 << 3,  // save the settings bytes
+    PendingAlarms = 1 << 4,    // save the alarm list
+} Pending;
+
+// What the last requested redraw showed besides the face's own pixels. refresh
+// asks for a redraw when it differs, even if the face reported nothing: the
+// page (and the day and UTC offset a date or sun page was rendered for), the
+// layout and inversion.
+typedef struct {
+    uint32_t day;      // date and sun pages: day_key, else 0
+    int16_t offset;    // sun page: home UTC offset in minutes, else 0
+    uint8_t page;      // clock mode Page, 0 in other modes
+    uint8_t layout;    // layout_key for a face, 0 for a page
+    bool inverted;
+} Shown;
+
+// Main loop message: an input event or a wakeup, plus the tick it happened at
+// (stamped in the callback, not when the main loop gets to it).
+typedef struct {
+    AppEventType type;
+    InputEvent input;
+    uint32_t tick;
+} AppEvent;
+
 typedef struct {
     FuriMessageQueue* q;      // input events from ViewPort callback -> main loop
     ViewPort* vp;             // fullscreen drawing + input hook
     FuriTimer* timer;         // periodic "tick" that requests a redraw
+    FuriTimer* wake;          // one-shot wakeup: next countdown/chess second, alarm
+    FuriTimer* light;         // one-shot: backlight off again (BacklightOff)
     NotificationApp* notif;   // backlight control (keep screen on during app)
+    FuriMutex* mutex;         // guards everything below (main loop vs draw_cb)
     bool mode_24h;            // false=12h with AM/PM, true=24h with "24"
+    bool show_seconds;        // true=HH:MM:SS, small seconds digits in the gutter
+    bool portrait;            // digits laid out HH above MM for a vertical mount
+    bool inverted;            // white on black
+    Face face;                // clock face (clock mode only)
+    int page;                 // clock mode Page (PageZone + i = zone i)
+    Chime chime;              // hourly / quarter-hour chimes
+    uint8_t quiet_from;       // no chimes from this hour...
+    uint8_t quiet_to;         // ...until this hour
+    uint32_t next_chime;      // RTC timestamp of the next chime slot
+    Backlight backlight_mode; // backlight policy
+    uint8_t dim_from;         // dim from this hour...
+    uint8_t dim_to;           // ...until this hour
+    uint8_t dim_level;        // backlight level while dimmed (of 255, scaled by system brightness)
+    uint32_t next_dim;        // RTC timestamp of the next schedule boundary
+    uint8_t light_secs;       // how long a key press lights the backlight (BacklightOff)
+    bool lit;                 // BacklightOff: lit by a key press right now
+    InputKey swallow;         // key whose waking press is being eaten, InputKeyMAX = none
+    bool backlight_held;      // our enforce_on lock is held
+    uint8_t backlight;        // level currently enforced (valid while held)
+    Power power;              // battery governor level
+    uint32_t next_power;      // RTC timestamp of the next battery sample
+    Mode mode;
+    ClockModel model;         // time of day -> DisplayState, memoized
+
+    Stopwatch stopwatch;
+    uint8_t stopwatch_fps;    // refresh cap while the stopwatch runs
+    Laps* laps;               // stopwatch lap history, allocated on the first lap
+    uint8_t pending;          // Pending writes, for flush_pending
+    Countdown countdown;
+    Chess chess;
+    Interval interval;
+    bool interval_rest;       // idle interval timer: showing the rest time, not the work time
+    Alarms alarms;
+    WorldClock world;         // zones shown as world clock pages
+    SunPlace place;           // where sunrise / sunset are computed for
+
+    Frame* frame;             // persistent offscreen image, blitted each draw
+    Frame* inverse;           // scratch for showing a frame inverted, allocated on first use
+    void* face_state[FaceCount]; // state of each ClockFace
+    void* portrait_state;     // state of portrait_face
+    Readout readout;          // last Readout given to the face (labels are drawn from it)
+    FaceRect damage[FACE_DAMAGE_MAX]; // reported, not yet rendered
+    uint8_t damage_count;     // > FACE_DAMAGE_MAX: too many, render the whole screen
+    uint32_t face_wake;       // RTC time the face next changes, 0 = every second or not a clock
+    Frame* date_page;         // date page, rendered once per day
+    uint32_t date_key;        // date the page was rendered for, 0 = none
+    Frame* sun_page;          // sun page, rendered once per day
+    uint32_t sun_key;         // date the sun page was rendered for, 0 = none
+    int16_t sun_offset;       // UTC offset (minutes) it was rendered with
+    uint8_t drawn_layout;     // layout key the frame was laid out for
+    Shown shown;              // screen of the last redraw refresh asked for
+    Perf perf;
 } App;
 
+// The mode file started out as one flags byte (bit 0 = the original 24h bool).
+// Later settings are appended after it, one byte each; a shorter file written
+// by an older version leaves the missing ones at their defaults.
 #define MODE_FILE APP_DATA_PATH("mode24.bin")
 
-static bool load_mode_24h(void) {
-    bool mode = false;
+#define MODE_FLAG_24H      (1 << 0)
+#define MODE_FLAG_SECONDS  (1 << 1)
+#define MODE_FLAG_PORTRAIT (1 << 2)
+#define MODE_FLAG_INVERTED (1 << 3)
+
+enum {
+    SettingFlags,       // MODE_FLAG_*
+    SettingChime,       // Chime
+    SettingQuietFrom,   // quiet hours start (hour, inclusive)
+    SettingQuietTo,     // quiet hours end (hour, exclusive); == start means none
+    SettingFace,        // Face
+    SettingBacklight,   // Backlight (byte was 1 = dimming on before BacklightOff)
+    SettingDimFrom,     // dim from (hour, inclusive)
+    SettingDimTo,       // dim until (hour, exclusive); == from means never
+    SettingDimLevel,    // backlight level while dimmed, 1..255
+    SettingLightSecs,   // seconds a key press lights the backlight, 1..255
+    SettingStopwatchFps, // stopwatch refresh cap while running, 1..STOPWATCH_FPS_MAX
+    SettingCount,
+};
+
+static uint8_t mode_flags(const App* app) {
+    return (app->mode_24h ? MODE_FLAG_24H : 0) | (app->show_seconds ? MODE_FLAG_SECONDS : 0) |
+           (app->portrait ? MODE_FLAG_PORTRAIT : 0) | (app->inverted ? MODE_FLAG_INVERTED : 0);
+}
+
+// The face actually on screen: faces apply to the clock's own time page only.
+static Face shown_face(const App* app) {
+    return (app->mode == ModeClock && app->page == PageTime) ? app->face : FaceDigital;
+}
+
+// Portrait is a layout of the digital face; the other faces and pages stay landscape.
+static bool portrait(const App* app) {
+    return LAYOUT_PORTRAIT && app->portrait && shown_face(app) == FaceDigital;
+}
+
+// Everything that decides where things go on screen. A change means a full redraw.
+// Inversion isn't in it: it is applied on the way out, the frame stays as it is.
+static uint8_t layout_key(const App* app) {
+    uint8_t flags = mode_flags(app) & (MODE_FLAG_24H | MODE_FLAG_SECONDS);
+    if(portrait(app)) flags |= MODE_FLAG_PORTRAIT;
+    return flags | (uint8_t)(shown_face(app) << 3) | (uint8_t)(app->mode << 5);
+}
+
+// Backlight off by choice, or by the battery governor.
+static bool backlight_off(const App* app) {
+    return app->backlight_mode == BacklightOff || app->power == PowerCritical;
+}
+
+// ...and not lit by a key press right now.
+static bool dark(const App* app) {
+    return backlight_off(app) && !app->lit;
+}
+
+// Nobody can read seconds (dark), or the battery can't afford them: the clock
+// drops to one redraw a minute and hides its seconds.
+static bool frugal(const App* app) {
+    return dark(app) || app->power != PowerNormal;
+}
+
+static void load_settings(App* app) {
+    uint8_t b[SettingCount] = {
+        [SettingFlags] = 0,
+        [SettingChime] = ChimeOff,
+        [SettingQuietFrom] = 22,
+        [SettingQuietTo] = 7,
+        [SettingFace] = FaceDigital,
+        [SettingBacklight] = BacklightOn,
+        [SettingDimFrom] = 22,
+        [SettingDimTo] = 7,
+        [SettingDimLevel] = 32,
+        [SettingLightSecs] = 5,
+        [SettingStopwatchFps] = STOPWATCH_FPS_DEFAULT,
+    };
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* f = storage_file_alloc(storage);
@@ -42,8 +339,7 @@ static bool load_mode_24h(void) {
     storage_common_resolve_path_and_ensure_app_directory(storage, path);
 
     if(storage_file_open(f, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
-        uint8_t b = 0;
-        if(storage_file_read(f, &b, 1) == 1) mode = (b != 0);
+        storage_file_read(f, b, sizeof(b));
         storage_file_close(f);
     }
 
@@ -51,10 +347,39 @@ static bool load_mode_24h(void) {
     storage_file_free(f);
     furi_record_close(RECORD_STORAGE);
 
-    return mode;
+    app->mode_24h = (b[SettingFlags] & MODE_FLAG_24H) != 0;
+    app->show_seconds = (b[SettingFlags] & MODE_FLAG_SECONDS) != 0;
+    app->portrait = (b[SettingFlags] & MODE_FLAG_PORTRAIT) != 0;
+    app->inverted = (b[SettingFlags] & MODE_FLAG_INVERTED) != 0;
+    app->chime = (b[SettingChime] < ChimeCount) ? (Chime)b[SettingChime] : ChimeOff;
+    app->quiet_from = b[SettingQuietFrom] % 24;
+    app->quiet_to = b[SettingQuietTo] % 24;
+    app->face = (b[SettingFace] < FaceCount) ? (Face)b[SettingFace] : FaceDigital;
+    app->backlight_mode =
+        (b[SettingBacklight] < BacklightCount) ? (Backlight)b[SettingBacklight] : BacklightOn;
+    app->dim_from = b[SettingDimFrom] % 24;
+    app->dim_to = b[SettingDimTo] % 24;
+    app->dim_level = MAX(b[SettingDimLevel], 1);
+    app->light_secs = MAX(b[SettingLightSecs], 1);
+    app->stopwatch_fps = MIN(MAX(b[SettingStopwatchFps], 1), STOPWATCH_FPS_MAX);
+}
+
+// The settings file's bytes, snapshotted for write_settings.
+static void settings_bytes(const App* app, uint8_t b[SettingCount]) {
+    b[SettingFlags] = mode_flags(app);
+    b[SettingChime] = app->chime;
+    b[SettingQuietFrom] = app->quiet_from;
+    b[SettingQuietTo] = app->quiet_to;
+    b[SettingFace] = app->face;
+    b[SettingBacklight] = app->backlight_mode;
+    b[SettingDimFrom] = app->dim_from;
+    b[SettingDimTo] = app->dim_to;
+    b[SettingDimLevel] = app->dim_level;
+    b[SettingLightSecs] = app->light_secs;
+    b[SettingStopwatchFps] = app->stopwatch_fps;
 }
 
-static void save_mode_24h(bool mode) {
+static void write_settings(const uint8_t b[SettingCount]) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* f = storage_file_alloc(storage);
 
@@ -62,175 +387,745 @@ static void save_mode_24h(bool mode) {
     storage_common_resolve_path_and_ensure_app_directory(storage, path);
 
     if(storage_file_open(f, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
-        uint8_t b = mode ? 1 : 0;
-        storage_file_write(f, &b, 1);
+        storage_file_write(f, b, SettingCount);
+        storage_file_close(f);
+    }
+
+    furi_string_free(path);
+    storage_file_free(f);
+    furi_record_close(RECORD_STORAGE);
+}
+
+// Read a small text file from the app data folder into buf (NUL-terminated).
+// Returns its length, 0 if it is missing or empty.
+static size_t read_text_file(const char* file, char* buf, size_t max) {
+    size_t len = 0;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* f = storage_file_alloc(storage);
+
+    FuriString* path = furi_string_alloc_set(file);
+    storage_common_resolve_path_and_ensure_app_directory(storage, path);
+
+    if(storage_file_open(f, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+        len = storage_file_read(f, buf, max - 1);
         storage_file_close(f);
     }
 
     furi_string_free(path);
     storage_file_free(f);
     furi_record_close(RECORD_STORAGE);
+
+    buf[len] = '\0';
+    return len;
+}
+
+// Stopwatch laps: the held laps as CSV, rewritten whole in one write.
+#define LAPS_FILE APP_DATA_PATH("laps.csv")
+
+// Write the CSV text (laps_csv_text) in one go. True if it all went out.
+static bool write_laps(const char* csv, size_t len) {
+    bool ok = false;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* f = storage_file_alloc(storage);
+
+    FuriString* path = furi_string_alloc_set(LAPS_FILE);
+    storage_common_resolve_path_and_ensure_app_directory(storage, path);
+
+    if(storage_file_open(f, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        ok = storage_file_write(f, csv, len) == len;
+        storage_file_close(f);
+    }
+
+    furi_string_free(path);
+    storage_file_free(f);
+    furi_record_close(RECORD_STORAGE);
+    return ok;
+}
+
+static void log_laps_export(const Laps* laps, bool ok) {
+    FURI_LOG_I(
+        TAG,
+        "laps: %lu of %lu exported%s",
+        (unsigned long)laps_held(laps),
+        (unsigned long)laps->count,
+        ok ? "" : " (failed)");
+}
+
+// Export the lap history unless there is nothing new since the last export.
+// At exit only, with nothing else running; the main loop goes through
+// PendingLaps instead.
+static void export_laps(App* app) {
+    Laps* laps = app->laps;
+    if(!laps || laps->saved) return;
+
+    size_t len;
+    char* csv = laps_csv_text(laps, furi_kernel_get_tick_frequency(), &len);
+    laps->saved = write_laps(csv, len);
+    free(csv);
+    log_laps_export(laps, laps->saved);
+}
+
+// Interval timer: one IntervalRecord (12 bytes). A run in progress carries on
+// from it at the right phase, however long the app was closed.
+#define INTERVAL_FILE APP_DATA_PATH("interval.bin")
+
+static void load_interval(App* app, uint32_t ts) {
+    IntervalRecord rec;
+    bool ok = false;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* f = storage_file_alloc(storage);
+
+    FuriString* path = furi_string_alloc_set(INTERVAL_FILE);
+    storage_common_resolve_path_and_ensure_app_directory(storage, path);
+
+    if(storage_file_open(f, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+        ok = storage_file_read(f, &rec, sizeof(rec)) == sizeof(rec) &&
+             interval_restore(&app->interval, &rec, ts);
+        storage_file_close(f);
+    }
+
+    furi_string_free(path);
+    storage_file_free(f);
+    furi_record_close(RECORD_STORAGE);
+
+    if(ok) {
+        FURI_LOG_I(
+            TAG,
+            "interval: restored state %u, phase %u of %u",
+            app->interval.state,
+            app->interval.phase + 1,
+            app->interval.phases);
+    }
+}
+
+static void write_interval(const IntervalRecord* rec) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* f = storage_file_alloc(storage);
+
+    FuriString* path = furi_string_alloc_set(INTERVAL_FILE);
+    storage_common_resolve_path_and_ensure_app_directory(storage, path);
+
+    if(storage_file_open(f, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        storage_file_write(f, rec, sizeof(*rec));
+        storage_file_close(f);
+    }
+
+    furi_string_free(path);
+    storage_file_free(f);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void save_interval(const App* app) {
+    IntervalRecord rec;
+    interval_save(&app->interval, &rec);
+    write_interval(&rec);
+}
+
+// World clock zones: a text file, one zone name per line (see tools/zones.def).
+// The first line is the zone the Flipper's clock is set to, the rest get a page
+// each. Without a file the clock is taken to be on UTC.
+#define ZONES_FILE     APP_DATA_PATH("zones.txt")
+#define ZONES_DEFAULT  "UTC\nNewYork\nLondon\nTokyo\n"
+#define ZONES_FILE_MAX 1024
+
+static void load_zones(App* app) {
+    char* text = malloc(ZONES_FILE_MAX);
+    const size_t len = read_text_file(ZONES_FILE, text, ZONES_FILE_MAX);
+    world_config(&app->world, len ? text : ZONES_DEFAULT);
+    free(text);
+}
+
+// Sun page location: "lat lon" in decimal degrees. Greenwich without a file.
+#define LOCATION_FILE APP_DATA_PATH("location.txt")
+
+static void load_location(App* app) {
+    char text[64];
+    app->place = (SunPlace){5148, 0};
+    if(read_text_file(LOCATION_FILE, text, sizeof(text))) sun_parse_place(&app->place, text);
 }
 
 // ----------------------------------------------------------------------------
-// 7-seg digit drawing helpers
+// Perf counters
 // ----------------------------------------------------------------------------
 //
-// We draw big "7-segment" style digits using filled rectangles.
-// segmap encodes which segments are on for digits 0..9.
+// Pixels written into the Frame per draw. A full redraw is what a naive
+// draw-from-scratch would pay on every frame; partial redraws are what we
+// actually pay. Logged at debug level when the minute rolls over.
 //
-// bit positions:
-// 0=a (top)
-// 1=b (upper-right)
-// 2=c (lower-right)
-// 3=d (bottom)
-// 4=e (lower-left)
-// 5=f (upper-left)
-// 6=g (middle)
+static void perf_roll(Perf* p, int minute) {
+    if(minute == p->minute) return;
+
+    if(p->frames) {
+        FURI_LOG_D(
+            TAG,
+            "perf[%02x]: %lu frames, %lu px partial (%lu px/frame), %lu px per full redraw",
+            p->layout,
+            (unsigned long)p->frames,
+            (unsigned long)p->px_partial,
+            (unsigned long)(p->px_partial / p->frames),
+            (unsigned long)p->px_full);
+        FURI_LOG_D(TAG, "perf: worst input lag %lu ticks", (unsigned long)p->input_lag);
+    }
+    if(p->skipped) {
+        FURI_LOG_D(TAG, "perf: %lu redraws skipped, nothing changed", (unsigned long)p->skipped);
+    }
+    ClockModel* cm = p->model;
+    if(cm->hits || cm->minute_hits || cm->misses) {
+        FURI_LOG_D(
+            TAG,
+            "perf: clock model %lu same second, %lu same minute, %lu decoded",
+            (unsigned long)cm->hits,
+            (unsigned long)cm->minute_hits,
+            (unsigned long)cm->misses);
+        cm->hits = cm->minute_hits = cm->misses = 0;
+    }
+    if(p->chess_switches) {
+        FURI_LOG_D(
+            TAG,
+            "perf: %lu chess switches, worst press-to-charged %lu ticks",
+            (unsigned long)p->chess_switches,
+            (unsigned long)p->chess_lag);
+    }
+    p->frames = 0;
+    p->skipped = 0;
+    p->px_partial = 0;
+    p->input_lag = 0;
+    if(p->chimes) {
+        FURI_LOG_D(
+            TAG,
+            "perf: redraw latency %lu ticks at chime, %lu ticks otherwise",
+            (unsigned long)p->lat_chime,
+            (unsigned long)p->lat_other);
+    }
+    // The power and glyph cache lines are totals: logged only when they move.
+    if(p->power_changes != p->power_logged) {
+        FURI_LOG_D(
+            TAG,
+            "perf: power level time %lu/%lu/%lu s (normal/low/critical), %lu changes",
+            (unsigned long)p->power_secs[PowerNormal],
+            (unsigned long)p->power_secs[PowerLow],
+            (unsigned long)p->power_secs[PowerCritical],
+            (unsigned long)p->power_changes);
+        p->power_logged = p->power_changes;
+    }
+
+    // Glyph cache totals, and each cached set again whenever one was added.
+    GlyphCacheStats gc;
+    glyph_cache_stats(&gc);
+    if(gc.hits != p->glyph_hits || gc.misses != p->glyph_misses) {
+        FURI_LOG_D(
+            TAG,
+            "perf: glyph cache %lu hits, %lu misses, %u sets, %lu bytes",
+            (unsigned long)gc.hits,
+            (unsigned long)gc.misses,
+            gc.sets,
+            (unsigned long)gc.bytes);
+        p->glyph_hits = gc.hits;
+    }
+    if(gc.misses != p->glyph_misses) {
+        for(int i = 0; i < gc.sets; i++) {
+            uint32_t bytes;
+            const DigitSet* set = glyph_cache_set(i, &bytes);
+            FURI_LOG_D(
+                TAG,
+                "perf: glyphs %ux%u t%u, %lu bytes",
+                set->w,
+                set->h,
+                set->t,
+                (unsigned long)bytes);
+        }
+        p->glyph_misses = gc.misses;
+    }
+    p->chess_lag = 0;
+    p->chess_switches = 0;
+    p->chimes = 0;
+    p->lat_chime = 0;
+    p->lat_other = 0;
+    p->minute = minute;
+}
+
+static void perf_frame(Perf* p, const DateTime* dt, uint8_t layout, uint32_t px, bool full) {
+    perf_roll(p, dt->minute);
+
+    // Delay from the tick that asked for this redraw to it being drawn.
+    if(p->redraw_pending) {
+        const uint32_t lat = furi_get_tick() - p->redraw_req;
+        uint32_t* worst = p->redraw_chime ? &p->lat_chime : &p->lat_other;
+        if(lat > *worst) *worst = lat;
+        p->redraw_pending = false;
+    }
+
+    p->frames++;
+    if(full) {
+        p->px_full = px;
+        p->layout = layout;
+    } else {
+        p->px_partial += px;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Readouts
+// ----------------------------------------------------------------------------
 //
-static const uint8_t segmap[10] = {
-    /*0*/ 0b0111111,
-    /*1*/ 0b0000110,
-    /*2*/ 0b1011011,
-    /*3*/ 0b1001111,
-    /*4*/ 0b1100110,
-    /*5*/ 0b1101101,
-    /*6*/ 0b1111101,
-    /*7*/ 0b0000111,
-    /*8*/ 0b1111111,
-    /*9*/ 0b1101111,
-};
+// Each mode turns its state into a Readout (face.h).
+//
+
+// The clock's settings as the clock model takes them.
+static uint8_t clock_settings(const App* app) {
+    return (app->mode_24h ? CLOCK_24H : 0) | (app->show_seconds ? CLOCK_SECONDS : 0) |
+           (frugal(app) ? CLOCK_FRUGAL : 0);
+}
 
-static void segdigit(Canvas* c, int x, int y, int w, int h, int t, int d) {
-    // d is -1 to mean "blank" (used for leading zero in hours).
-    if(d < 0 || d > 9) return;
+static void readout_clock(App* app, uint32_t second_of_day, Readout* r) {
+    display_readout(clock_model(&app->model, second_of_day, clock_settings(app)), r);
+    r->minute_s = 60 - second_of_day % 60;
+}
+
+// World clock page: the clock readout for zone i's time, tagged with the zone.
+// world_tick keeps the offsets cached; the table is only searched when a
+// transition has been crossed.
+static void readout_zone(App* app, uint32_t local, int i, Readout* r) {
+    world_tick(&app->world, local);
+
+    readout_clock(app, world_time(&app->world, i, local) % 86400, r);
+    r->label[0] = tz_zones[app->world.zone[i]].tag;
+}
+
+static void readout_stopwatch(const App* app, uint32_t now, Readout* r) {
+    const Stopwatch* sw = &app->stopwatch;
+    const uint64_t ms =
+        (uint64_t)stopwatch_elapsed(sw, now) * 1000 / furi_kernel_get_tick_frequency();
+
+    const uint32_t S = (uint32_t)(ms / 1000) % 60;
+    const uint32_t M = (uint32_t)(ms / 60000) % 60;
+
+    if(ms < 3600000) {
+        // MM:SS, hundredths in the gutter.
+        const uint32_t cs = (uint32_t)(ms / 10) % 100;
+        r->big[0] = (int8_t)(M / 10);
+        r->big[1] = (int8_t)(M % 10);
+        r->big[2] = (int8_t)(S / 10);
+        r->big[3] = (int8_t)(S % 10);
+        r->small_digit[0] = (int8_t)(cs / 10);
+        r->small_digit[1] = (int8_t)(cs % 10);
+    } else {
+        // HH:MM, seconds in the gutter.
+        const uint32_t H = (uint32_t)(ms / 3600000) % 100;
+        r->big[0] = (int8_t)(H / 10);
+        r->big[1] = (int8_t)(H % 10);
+        r->big[2] = (int8_t)(M / 10);
+        r->big[3] = (int8_t)(M % 10);
+        r->small_digit[0] = (int8_t)(S / 10);
+        r->small_digit[1] = (int8_t)(S % 10);
+    }
+    r->small = true;
+
+    r->label[0] = "SW";
+    if(sw->laps) {
+        snprintf(r->label_buf, sizeof(r->label_buf), "%lu", (unsigned long)(sw->laps % 100));
+        r->label[1] = r->label_buf;
+    }
+}
+
+static void readout_countdown(const App* app, uint32_t now, Readout* r) {
+    const Countdown* cd = &app->countdown;
+    const uint32_t s = countdown_display_s(cd, now);
+
+    const uint32_t H = s / 3600;
+    const uint32_t M = (s / 60) % 60;
+    const uint32_t S = s % 60;
+
+    if(H == 0) {
+        // MM:SS, gutter blank.
+        r->big[0] = (int8_t)(M / 10);
+        r->big[1] = (int8_t)(M % 10);
+        r->big[2] = (int8_t)(S / 10);
+        r->big[3] = (int8_t)(S % 10);
+        r->small_digit[0] = -1;
+        r->small_digit[1] = -1;
+    } else {
+        // HH:MM, seconds in the gutter.
+        r->big[0] = (int8_t)(H / 10);
+        r->big[1] = (int8_t)(H % 10);
+        r->big[2] = (int8_t)(M / 10);
+        r->big[3] = (int8_t)(M % 10);
+        r->small_digit[0] = (int8_t)(S / 10);
+        r->small_digit[1] = (int8_t)(S % 10);
+    }
+    r->small = true;
+
+    r->label[0] = "CD";
+    if(cd->state == CountdownPaused) r->label[1] = "||";
+    if(cd->state == CountdownExpired) r->label[2] = "!!";
+}
+
+static void readout_chess(const App* app, uint32_t now, Readout* r) {
+    const Chess* ch = &app->chess;
+
+    // Big digits: the side to move (side 0 before the game starts).
+    // Gutter: the opponent's whole minutes.
+    const int side = ch->turn < 0 ? 0 : ch->turn;
+    const uint32_t s = countdown_display_s(&ch->side[side], now);
+    const uint32_t other = countdown_display_s(&ch->side[!side], now) / 60;
+
+    if(s < 3600) {
+        r->big[0] = (int8_t)(s / 600);
+        r->big[1] = (int8_t)((s / 60) % 10);
+        r->big[2] = (int8_t)((s % 60) / 10);
+        r->big[3] = (int8_t)(s % 10);
+    } else {
+        const uint32_t H = MIN(s / 3600, 99UL);
+        const uint32_t M = (s / 60) % 60;
+        r->big[0] = (int8_t)(H / 10);
+        r->big[1] = (int8_t)(H % 10);
+        r->big[2] = (int8_t)(M / 10);
+        r->big[3] = (int8_t)(M % 10);
+    }
+    r->small = true;
+    r->small_digit[0] = (int8_t)(MIN(other, 99UL) / 10);
+    r->small_digit[1] = (int8_t)(MIN(other, 99UL) % 10);
+
+    r->label[0] = side ? "P2" : "P1";
+    if(ch->paused) r->label[1] = "||";
+    if(ch->flagged) r->label[2] = "!!";
+}
+
+static void readout_interval(const App* app, uint32_t ts, Readout* r) {
+    const Interval* iv = &app->interval;
+    const bool idle = iv->state == IntervalIdle;
+    const uint32_t s = (idle && app->interval_rest) ? iv->rest_s : interval_left(iv, ts);
+    const uint32_t M = MIN(s / 60, 99UL);
+    const uint32_t S = s % 60;
+
+    // MM:SS of the phase; the gutter has the cycle (or, idle, the cycle count).
+    r->big[0] = (int8_t)(M / 10);
+    r->big[1] = (int8_t)(M % 10);
+    r->big[2] = (int8_t)(S / 10);
+    r->big[3] = (int8_t)(S % 10);
+    const uint32_t cycle = idle ? iv->cycles : MIN(iv->phase / 2 + 1, iv->cycles);
+    r->small = true;
+    r->small_digit[0] = (int8_t)(cycle / 10);
+    r->small_digit[1] = (int8_t)(cycle % 10);
+
+    const bool rest = idle ? app->interval_rest : interval_resting(iv);
+    r->label[0] = rest ? "RS" : "WK";
+    if(iv->state == IntervalPaused) r->label[1] = "||";
+    if(iv->state == IntervalDone) r->label[2] = "!!";
+}
+
+static void readout(App* app, const DateTime* dt, Readout* r) {
+    switch(app->mode) {
+    case ModeStopwatch:
+        readout_stopwatch(app, furi_get_tick(), r);
+        break;
+    case ModeCountdown:
+        readout_countdown(app, furi_get_tick(), r);
+        break;
+    case ModeChess:
+        readout_chess(app, furi_get_tick(), r);
+        break;
+    case ModeInterval: {
+        DateTime now = *dt;
+        readout_interval(app, datetime_datetime_to_timestamp(&now), r);
+        break;
+    }
+    default:
+        if(app->page >= PageZone) {
+            // datetime_datetime_to_timestamp takes a non-const DateTime.
+            DateTime now = *dt;
+            readout_zone(app, datetime_datetime_to_timestamp(&now), app->page - PageZone, r);
+        } else {
+            readout_clock(app, dt->hour * 3600UL + dt->minute * 60UL + dt->second, r);
+        }
+        break;
+    }
+}
 
-    uint8_t m = segmap[d];
-    int ym = y + (h / 2);
-    int half = h / 2;
+static bool same_label(const char* a, const char* b) {
+    return (a && b) ? strcmp(a, b) == 0 : a == b;
+}
 
-    // Horizontal segments. Full width so overlaps look solid (especially digit 8).
-    if(m & (1 << 0)) canvas_draw_box(c, x, y, w, t);               // a
-    if(m & (1 << 6)) canvas_draw_box(c, x, ym - (t / 2), w, t);    // g
-    if(m & (1 << 3)) canvas_draw_box(c, x, y + h - t, w, t);       // d
+// Copy a Readout, keeping labels that point into its own label_buf pointing
+// into the copy.
+static void readout_keep(Readout* dst, const Readout* src) {
+    *dst = *src;
+    for(int i = 0; i < 3; i++) {
+        if(src->label[i] == src->label_buf) dst->label[i] = dst->label_buf;
+    }
+}
 
-    // Vertical segments. Each spans half height so they meet the middle bar cleanly.
-    if(m & (1 << 5)) canvas_draw_box(c, x, y, t, half);                       // f
-    if(m & (1 << 1)) canvas_draw_box(c, x + w - t, y, t, half);               // b
-    if(m & (1 << 4)) canvas_draw_box(c, x, y + h - half, t, half);            // e
-    if(m & (1 << 2)) canvas_draw_box(c, x + w - t, y + h - half, t, half);    // c
+// Gutter labels: three fixed rows under the gutter column (landscape only).
+static void draw_labels(Canvas* canvas, const Readout* r) {
+    canvas_set_font(canvas, FontKeyboard);
+    for(int i = 0; i < 3; i++) {
+        if(r->label[i]) canvas_draw_str(canvas, LABEL_X, LABEL_Y(i), r->label[i]);
+    }
+    canvas_set_font(canvas, FontPrimary);
 }
 
-static void draw_colon(Canvas* c, int x, int y, int t) {
-    // Two square dots between HH and MM.
-    canvas_draw_box(c, x, y + 16, t, t);
-    canvas_draw_box(c, x, y + 40, t, t);
+// ----------------------------------------------------------------------------
+// Output
+// ----------------------------------------------------------------------------
+//
+// Every page ends in one blit of a finished Frame. Inverted, that frame goes
+// through one XOR pass into a scratch frame first (frame_invert), and the
+// canvas text on top is drawn white; nothing else changes, so the cached
+// frames and the incremental redraws are shared by both.
+//
+static void present(App* app, Canvas* canvas, const Frame* f) {
+    if(!app->perf.started) {
+        // Entry to first frame, and what the clock holds on the heap by then.
+        const uint32_t ticks = furi_get_tick() - app->perf.start_tick;
+        FURI_LOG_I(
+            TAG,
+            "startup: %lu ms to first frame, %u bytes heap, settings menu %s",
+            (unsigned long)(ticks * 1000 / furi_kernel_get_tick_frequency()),
+            (unsigned)(app->perf.start_heap - memmgr_get_free_heap()),
+            BIGCLOCK_SETTINGS ? "built in" : "left out");
+        app->perf.started = true;
+    }
+    if(app->inverted) {
+        if(!app->inverse) app->inverse = malloc(sizeof(Frame));
+        frame_invert(app->inverse, f);
+        f = app->inverse;
+    }
+    canvas_draw_xbm(canvas, 0, 0, FRAME_W, FRAME_H, f->px);
+    canvas_set_color(canvas, app->inverted ? ColorWhite : ColorBlack);
 }
 
 // ----------------------------------------------------------------------------
-// Draw callback
+// Date page
 // ----------------------------------------------------------------------------
 //
-// This is called by the GUI when the ViewPort needs repainting.
-// We do not store time in app state. We read RTC each draw and render from scratch.
+// The page is cached in its own Frame and re-rendered only when the date
+// changes, so a normal draw is just the blit. It never touches app->frame:
+// switching back to the time page carries on with the incremental updates.
 //
-static void draw_cb(Canvas* canvas, void* ctx) {
-    App* app = ctx;
+static const char* const weekday_names[7] = {"MO", "TU", "WE", "TH", "FR", "SA", "SU"};
 
-    DateTime dt;
-    furi_hal_rtc_get_datetime(&dt);
+// The date as one number, never 0: what the date and sun pages are keyed by.
+static uint32_t day_key(const DateTime* dt) {
+    return ((uint32_t)dt->year << 9) | ((uint32_t)dt->month << 5) | dt->day;
+}
+
+static void draw_date_page(App* app, Canvas* canvas, const DateTime* dt) {
+    const uint32_t key = day_key(dt);
+    const bool render = (key != app->date_key);
 
-    const int H24 = (int)dt.hour;
-    const int M   = (int)dt.minute;
+    if(render) {
+        if(!app->date_page) app->date_page = malloc(sizeof(Frame));
+        const uint32_t px_before = app->date_page->px_written;
+        datepage_render(app->date_page, dt->day, dt->month, dt->year);
+        app->date_key = key;
+        // Counted under layout 0xFF, which no time page layout uses.
+        perf_frame(&app->perf, dt, 0xFF, app->date_page->px_written - px_before, true);
+    } else {
+        perf_frame(&app->perf, dt, 0xFF, 0, false);
+    }
 
-    int H = H24; // display hour
-    bool show_24 = app && app->mode_24h;
+    present(app, canvas, app->date_page);
 
-    if(!show_24) {
-        // 12-hour clock: 0 -> 12, 13 -> 1, etc.
-        H = H24 % 12;
-        if(H == 0) H = 12;
+    // Weekday in the top label row (1 = Monday).
+    if(dt->weekday >= 1 && dt->weekday <= 7) {
+        canvas_set_font(canvas, FontKeyboard);
+        canvas_draw_str(canvas, LABEL_X, LABEL_Y(0), weekday_names[dt->weekday - 1]);
+        canvas_set_font(canvas, FontPrimary);
     }
+}
 
-    // Hours tens digit is blank for 1..9 in 12h mode; in 24h mode show 0 for 00..09.
-    int ht_raw = H / 10;
-    int ht = ht_raw;
-    if(!show_24 && ht_raw == 0) ht = -1;
+// ----------------------------------------------------------------------------
+// Sun page
+// ----------------------------------------------------------------------------
+//
+// Same caching as the date page. Sunrise, sunset and the moon are computed
+// only when the page is rendered: on the first view of a day, or when the
+// home zone's UTC offset changes. The per-second tick never sees them.
+//
+static void draw_sun_page(App* app, Canvas* canvas, const DateTime* dt, uint32_t local) {
+    const uint32_t key = day_key(dt);
 
-    const int ho = H % 10;
+    world_tick(&app->world, local);
+    const int16_t offset = (int16_t)(app->world.home_offset / 60);
 
-    const int mt = M / 10;
-    const int mo = M % 10;
+    if(key != app->sun_key || offset != app->sun_offset) {
+        if(!app->sun_page) app->sun_page = malloc(sizeof(Frame));
+        const uint32_t px_before = app->sun_page->px_written;
 
-    // Layout constants tuned for 128x64.
-    // Right side reserves a narrow gutter for a small "alive" indicator.
-    const int y = 0;
-    const int h = 64;
-    const int t = 7;
+        SunDay sd;
+        sun_day(&sd, &app->place, dt->year, dt->month, dt->day);
+        sunpage_render(app->sun_page, &sd, offset);
+        app->sun_key = key;
+        app->sun_offset = offset;
+        perf_frame(&app->perf, dt, 0xFF, app->sun_page->px_written - px_before, true);
+    } else {
+        perf_frame(&app->perf, dt, 0xFF, 0, false);
+    }
 
-    const int bar_area_w = 12;
-    const int right_edge = 128 - 2 - bar_area_w;
+    present(app, canvas, app->sun_page);
+}
 
-    const int w = 23;
-    const int gap = 3;
-    const int colon_w = 6;
-    const int colon_gap = 2;
+// ----------------------------------------------------------------------------
+// Faces
+// ----------------------------------------------------------------------------
+//
+// Every face is a ClockFace (face.h), driven from here: the main loop's
+// refresh hands the face each new Readout and asks the GUI for a redraw only
+// if the face reported damage (or a label or what is Shown changed); draw_face
+// renders just the reported rectangles. The face also says when it next
+// changes, and in clock mode retime wakes for exactly that. Portrait is a
+// layout of the digital face with a face of its own, portrait_face.
+//
+static const ClockFace* const clock_faces[FaceCount] = {
+    [FaceDigital] = &seg_face,
+    [FaceAnalog] = &analog_face,
+    [FaceBinary] = &binary_face,
+};
 
-    const int x0 = 2;
+// The face on screen, NULL for the date and sun pages.
+static const ClockFace* clock_face(const App* app) {
+    if(app->mode == ModeClock && (app->page == PageDate || app->page == PageSun)) return NULL;
+    if(portrait(app)) return &portrait_face;
+    return clock_faces[shown_face(app)];
+}
 
-    const int xH0 = x0;
-    const int xH1 = xH0 + w + gap;
+static void* clock_face_state(const App* app) {
+    return portrait(app) ? app->portrait_state : app->face_state[shown_face(app)];
+}
 
-    const int cx  = xH1 + w + colon_gap;
-    const int xM0 = cx + colon_w + colon_gap;
-    const int xM1 = xM0 + w + gap;
+static void add_damage(App* app, const FaceRect* rect) {
+    for(int i = 0; i < app->damage_count && i < FACE_DAMAGE_MAX; i++) {
+        if(memcmp(&app->damage[i], rect, sizeof(FaceRect)) == 0) return;
+    }
+    if(app->damage_count < FACE_DAMAGE_MAX) app->damage[app->damage_count] = *rect;
+    if(app->damage_count <= FACE_DAMAGE_MAX) app->damage_count++;
+}
 
-    // Defensive guard: if constants ever change and overflow the screen, draw a marker.
-    if(xM1 + w <= right_edge) {
-        segdigit(canvas, xH0, y, w, h, t, ht);
-        segdigit(canvas, xH1, y, w, h, t, ho);
-        draw_colon(canvas, cx, y, colon_w);
-        segdigit(canvas, xM0, y, w, h, t, mt);
-        segdigit(canvas, xM1, y, w, h, t, mo);
-    } else {
-        canvas_draw_box(canvas, 0, 0, 3, 3);
+static void retime(App* app);
+
+// Keep the RTC time the screen next changes by itself, when that is more than
+// a second away (0 = the periodic tick covers it), rescheduling when it moves.
+static void face_retime(App* app, DateTime* dt, uint8_t next_s) {
+    const uint32_t at = next_s > 1 ? datetime_datetime_to_timestamp(dt) + next_s : 0;
+    if(at == app->face_wake) return;
+    app->face_wake = at;
+    retime(app);
+}
+
+// What the screen shows now, as Shown. The pages change only with the day
+// (and the sun page with the home zone's offset), so the per-second tick
+// finds them unchanged and doesn't redraw them.
+static Shown shown(App* app, DateTime* dt, bool page) {
+    Shown s;
+    memset(&s, 0, sizeof(s)); // compared with memcmp, padding included
+    s.inverted = app->inverted;
+    if(app->mode == ModeClock) s.page = (uint8_t)app->page;
+    if(!page) {
+        s.layout = layout_key(app);
+        return s;
+    }
+    s.day = day_key(dt);
+    if(app->page == PageSun) {
+        world_tick(&app->world, datetime_datetime_to_timestamp(dt));
+        s.offset = (int16_t)(app->world.home_offset / 60);
     }
+    return s;
+}
 
-    // 10-second progress indicator: draw N outlined boxes (no fill), where:
-    // 0s => 0 boxes, 10s => 1 box, ... 50s => 5 boxes.
-    const int steps = 5;
-    int count = (int)dt.second / 10; // 0..5
-    if(count > steps) count = steps;
+// Ask the GUI for a redraw if anything on screen changes. Returns whether it did.
+static bool refresh(App* app) {
+    DateTime dt;
+    furi_hal_rtc_get_datetime(&dt);
 
-    // Make the column shorter to leave room for AM/PM at the bottom.
-    const int bar_w = 11;
-    const int bar_h = 7;
-    const int bar_gap = 1;
+    const ClockFace* cf = clock_face(app);
+    const Shown now = shown(app, &dt, !cf);
+    bool changed = memcmp(&now, &app->shown, sizeof(now)) != 0;
+    app->shown = now;
 
-    const int bx = right_edge + ((bar_area_w - bar_w + 1) / 2) ;
-    const int by = 0;
+    if(!cf) {
+        face_retime(app, &dt, 0);
+    } else {
+        Readout r = {0};
+        readout(app, &dt, &r);
+
+        FaceRect damage[FACE_DAMAGE_MAX];
+        uint8_t next_s = 0;
+        const int n = cf->on_tick(clock_face_state(app), &r, damage, &next_s);
+        for(int i = 0; i < n; i++) add_damage(app, &damage[i]);
+        face_retime(app, &dt, next_s);
+
+        changed |= n > 0;
+        for(int i = 0; i < 3; i++) changed |= !same_label(r.label[i], app->readout.label[i]);
+        readout_keep(&app->readout, &r);
+    }
 
-    for(int i = 0; i < count; i++) {
-        int yy = by + i * (bar_h + bar_gap);
-        canvas_draw_frame(canvas, bx, yy, bar_w, bar_h);
+    if(!changed) {
+        app->perf.skipped++;
+        return false;
     }
+    view_port_update(app->vp);
+    return true;
+}
 
-    // AM/PM indicator (LCD-style): two fixed labels, only one is "lit".
-    // They must not occupy the same location.
-    const bool is_pm = (H24 >= 12);
-    const bool is_am = !is_pm;
+static void draw_face(App* app, Canvas* canvas, const ClockFace* cf, const DateTime* dt) {
+    void* face = clock_face_state(app);
+    Frame* f = app->frame;
+    const uint32_t px_before = f->px_written;
 
-    const int ap_x = right_edge + 1;
-    const int ap_y0 = 48;
+    // The frame holds another layout (or nothing yet): start over.
+    const uint8_t layout = layout_key(app);
+    if(layout != app->drawn_layout) {
+        app->damage_count = FACE_DAMAGE_MAX + 1;
+        app->drawn_layout = layout;
+    }
 
-    canvas_set_font(canvas, FontKeyboard);
-    if(show_24) {
-        canvas_draw_str(canvas, ap_x, ap_y0, "24");
+    const bool full = app->damage_count > FACE_DAMAGE_MAX;
+    if(full) {
+        cf->render(face, f, &face_screen);
     } else {
-        if(is_am) canvas_draw_str(canvas, ap_x, ap_y0 + 8, "AM");
-        if(is_pm) canvas_draw_str(canvas, ap_x, ap_y0 + 16, "PM");
+        for(int i = 0; i < app->damage_count; i++) cf->render(face, f, &app->damage[i]);
     }
-    canvas_set_font(canvas, FontPrimary);
+    app->damage_count = 0;
+
+    perf_frame(&app->perf, dt, layout, f->px_written - px_before, full);
+    present(app, canvas, f);
+
+    // Portrait draws its labels into the frame.
+    if(!portrait(app)) draw_labels(canvas, &app->readout);
+}
+
+// ----------------------------------------------------------------------------
+// Draw callback
+// ----------------------------------------------------------------------------
+//
+// This is called by the GUI when the ViewPort needs repainting. The pages
+// render themselves once per day; a face renders the rectangles refresh
+// collected from it into the offscreen Frame, then the Frame is blitted.
+// Hours and minutes are therefore rewritten only when they roll over, and in
+// HH:MM:SS mode a normal tick touches just the small seconds digits.
+//
+static void draw_cb(Canvas* canvas, void* ctx) {
+    App* app = ctx;
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+
+    DateTime dt;
+    furi_hal_rtc_get_datetime(&dt);
+
+    if(app->mode == ModeClock && (app->page == PageDate || app->page == PageSun)) {
+        if(app->page == PageDate) {
+            draw_date_page(app, canvas, &dt);
+        } else {
+            draw_sun_page(app, canvas, &dt, datetime_datetime_to_timestamp(&dt));
+        }
+        furi_mutex_release(app->mutex);
+        return;
+    }
+
+    draw_face(app, canvas, clock_face(app), &dt);
+    furi_mutex_release(app->mutex);
 }
 
 // ----------------------------------------------------------------------------
@@ -239,18 +1134,845 @@ static void draw_cb(Canvas* canvas, void* ctx) {
 //
 // ViewPort input callback runs in GUI context.
 // We do the standard pattern: enqueue the event and let the main loop handle it.
+// The tick is stamped here, at the press, so timing modes charge the moment the
+// key went down rather than whenever the main loop gets to the event.
 //
+// Chess switches go one step further and are recorded right here, on
+// InputTypePress (InputTypeShort only arrives on release). The main loop can't
+// delay them, and draw_cb runs on this same GUI thread, so no redraw can be in
+// progress while the switch is charged. A press that finds its side already
+// out of time flags it instead; the event goes on to the main loop as a wake,
+// which reports the flag (handle_wake) as if chess_poll had seen it first.
+//
+static void chess_switch(App* app, AppEvent* ev) {
+    const int side = (ev->input.key == InputKeyLeft) ? 0 : 1;
+    if(!chess_press(&app->chess, side, ev->tick)) {
+        if(app->chess.flagged && !app->chess.reported) ev->type = AppEventWake;
+        return;
+    }
+
+    const uint32_t lag = furi_get_tick() - ev->tick;
+    if(lag > app->perf.chess_lag) app->perf.chess_lag = lag;
+    app->perf.chess_switches++;
+}
+
 static void input_cb(InputEvent* event, void* ctx) {
     App* app = ctx;
-    furi_message_queue_put(app->q, event, FuriWaitForever);
+    AppEvent ev = {.type = AppEventInput, .input = *event, .tick = furi_get_tick()};
+
+    // With the backlight off, the first press only wakes it: that key's whole
+    // press (short, long, repeats, release) is eaten here, before chess or the
+    // main loop can act on it.
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    bool eaten = false;
+    if(app->swallow == event->key) {
+        if(event->type == InputTypeRelease) app->swallow = InputKeyMAX;
+        eaten = true;
+    } else if(event->type == InputTypePress && dark(app)) {
+        app->lit = true;
+        app->swallow = event->key;
+        ev.type = AppEventLight;
+    } else if(
+        event->type == InputTypePress && app->mode == ModeChess &&
+        (event->key == InputKeyLeft || event->key == InputKeyRight)) {
+        chess_switch(app, &ev);
+    }
+    furi_mutex_release(app->mutex);
+    if(eaten) return;
+
+    furi_message_queue_put(app->q, &ev, FuriWaitForever);
+}
+
+// Light timer callback (timer thread): the backlight's time is up.
+static void light_cb(void* ctx) {
+    App* app = ctx;
+    AppEvent ev = {.type = AppEventDark, .tick = furi_get_tick()};
+    furi_message_queue_put(app->q, &ev, 0);
+}
+
+//
+// Wake timer callback (timer thread): hand the wakeup to the main loop.
+// Never block here; a full queue just means the main loop is already busy.
+//
+static void wake_cb(void* ctx) {
+    App* app = ctx;
+    AppEvent ev = {.type = AppEventWake, .tick = furi_get_tick()};
+    furi_message_queue_put(app->q, &ev, 0);
 }
 
 //
-// Timer callback: request a redraw of the ViewPort.
+// Timer callback: hand the tick to the main loop, stamped. Everything the
+// tick checks (alarms, chimes, the dimming window, ...) belongs to the main
+// loop and is read there under the mutex (tick_due), never from this thread.
 //
 static void tick_cb(void* ctx) {
-    ViewPort* vp = ctx;
-    view_port_update(vp);
+    App* app = ctx;
+    AppEvent tick = {.type = AppEventTick, .tick = furi_get_tick()};
+    furi_message_queue_put(app->q, &tick, 0);
+}
+
+// Ticks until a running Countdown next needs us: the next displayed second
+// while it is on screen, otherwise only its expiry. 0 = never.
+static uint32_t countdown_wake(const Countdown* cd, bool on_screen, uint32_t now) {
+    if(cd->state != CountdownRunning) return 0;
+    return on_screen ? countdown_next_wake(cd, now) : MAX(countdown_left(cd, now), 1UL);
+}
+
+// Ticks until RTC timestamp `at` (at least 1). 0 = never.
+static uint32_t rtc_wake(uint32_t at, uint32_t ts) {
+    if(at == UINT32_MAX) return 0;
+    const uint32_t in_s = (at > ts) ? at - ts : 0;
+    return MAX(in_s * furi_kernel_get_tick_frequency(), 1UL);
+}
+
+// Earlier of two wake delays, where 0 means "no wake".
+static uint32_t wake_min(uint32_t a, uint32_t b) {
+    if(!a) return b;
+    if(!b) return a;
+    return MIN(a, b);
+}
+
+// Schedule redraws for the current mode.
+//
+// Countdown and chess never poll: while one is on screen the one-shot wake
+// timer is armed for the exact tick its displayed second changes, and while
+// another mode is showing it is armed once, for the expiry. The clock wakes
+// when its face next changes (app->face_wake) if that is more than a second
+// away, and on frugal pages at each minute. Everything else redraws once a
+// second, or at the stopwatch frame rate cap while that runs. The wake timer
+// also covers the next alarm and interval phase change, for modes without
+// periodic ticks.
+static void retime(App* app) {
+    const uint32_t now = furi_get_tick();
+    const Chess* ch = &app->chess;
+
+    uint32_t wake = countdown_wake(&app->countdown, app->mode == ModeCountdown, now);
+    if(chess_running(ch)) {
+        wake = wake_min(wake, countdown_wake(&ch->side[ch->turn], app->mode == ModeChess, now));
+    }
+    const uint32_t ts = furi_hal_rtc_get_timestamp();
+    uint32_t face_at = 0;
+    if(app->mode == ModeClock) {
+        face_at = app->face_wake;
+        if(!face_at && frugal(app)) face_at = ts - ts % 60 + 60;
+    }
+    if(face_at) wake = wake_min(wake, rtc_wake(face_at, ts));
+    wake = wake_min(wake, rtc_wake(app->alarms.next, ts));
+    wake = wake_min(wake, rtc_wake(interval_deadline(&app->interval), ts));
+    wake = wake_min(wake, rtc_wake(app->next_chime, ts));
+    wake = wake_min(wake, rtc_wake(app->next_dim, ts));
+    wake = wake_min(wake, rtc_wake(app->next_power, ts));
+    if(wake) {
+        furi_timer_start(app->wake, wake);
+    } else {
+        furi_timer_stop(app->wake);
+    }
+
+    if(app->mode == ModeCountdown || app->mode == ModeChess || face_at) {
+        furi_timer_stop(app->timer);
+        return;
+    }
+
+    uint32_t ms = 1000;
+    if(app->mode == ModeStopwatch && app->stopwatch.running) ms = 1000 / app->stopwatch_fps;
+    furi_timer_start(app->timer, furi_ms_to_ticks(ms));
+}
+
+// ----------------------------------------------------------------------------
+// Chimes
+// ----------------------------------------------------------------------------
+//
+// Like alarms, only the next chime slot is kept (app->next_chime); tick_due
+// compares against it and handle_wake plays it. notification_message queues
+// the sequence and returns, so the chime never blocks the main loop or a redraw.
+//
+static const NotificationSequence sequence_chime_quarter = {
+    &message_note_e5,
+    &message_vibro_on,
+    &message_delay_50,
+    &message_vibro_off,
+    &message_delay_50,
+    &message_sound_off,
+    NULL,
+};
+
+static const NotificationSequence sequence_chime_hour = {
+    &message_note_c6,
+    &message_vibro_on,
+    &message_delay_100,
+    &message_vibro_off,
+    &message_sound_off,
+    &message_delay_100,
+    &message_note_g5,
+    &message_vibro_on,
+    &message_delay_250,
+    &message_vibro_off,
+    &message_sound_off,
+    NULL,
+};
+
+static void schedule_chime(App* app, uint32_t ts) {
+    const uint32_t step = (app->chime == ChimeQuarter) ? 15 * 60 : 60 * 60;
+    app->next_chime = (app->chime == ChimeOff) ? UINT32_MAX : (ts / step + 1) * step;
+}
+
+// Whether RTC timestamp ts falls in the hours [from, to), which may wrap past
+// midnight. from == to is an empty window.
+static bool in_hours(uint8_t from, uint8_t to, uint32_t ts) {
+    const uint8_t h = (ts / 3600) % 24;
+    if(from == to) return false;
+    if(from < to) return h >= from && h < to;
+    return h >= from || h < to; // wraps past midnight
+}
+
+static bool chime_quiet(const App* app, uint32_t ts) {
+    return in_hours(app->quiet_from, app->quiet_to, ts);
+}
+
+static void handle_chime(App* app, uint32_t ts) {
+    const uint32_t slot = app->next_chime;
+    schedule_chime(app, ts);
+
+    // A wake that comes more than a minute late is skipped, not chimed late.
+    if(ts - slot >= 60 || chime_quiet(app, slot)) return;
+
+    if(slot % 3600 == 0) {
+        notification_message(app->notif, &sequence_chime_hour);
+    } else {
+        notification_message(app->notif, &sequence_chime_quarter);
+    }
+    app->perf.chimes++;
+}
+
+// ----------------------------------------------------------------------------
+// Backlight
+// ----------------------------------------------------------------------------
+//
+// The backlight is enforced on for as long as the app runs, at full level or,
+// inside the dimming window, at dim_level. The level is only re-evaluated at
+// the window's edges: next_dim holds the next one, and like chimes it is a
+// single compare in tick_due and a wake in retime.
+//
+// Energy model for the log line: backlight current is taken as linear in the
+// level, BACKLIGHT_FULL_UA at 255. That constant is a model figure, not a
+// measurement of this unit.
+#define BACKLIGHT_FULL_UA 12000
+
+// enforce_on only takes effect when it takes the lock, so a level change
+// releases the lock first. The message lives on the stack, hence _block.
+static void set_backlight(App* app, uint8_t level) {
+    if(app->backlight_held && level == app->backlight) return;
+
+    const NotificationMessage on = {
+        .type = NotificationMessageTypeLedDisplayBacklightEnforceOn,
+        .data.led.value = level,
+    };
+    const NotificationMessage* seq[] = {&message_display_backlight_enforce_auto, &on, NULL};
+    notification_message_block(
+        app->notif, (const NotificationSequence*)(app->backlight_held ? &seq[0] : &seq[1]));
+    app->backlight_held = true;
+    app->backlight = level;
+}
+
+static void schedule_dim(App* app, uint32_t ts) {
+    app->next_dim = UINT32_MAX;
+    if(app->backlight_mode != BacklightNightDim || app->dim_from == app->dim_to) return;
+
+    // Earliest of the two edges (today or tomorrow) after ts.
+    const uint32_t day = ts - ts % 86400;
+    const uint8_t edges[2] = {app->dim_from, app->dim_to};
+    for(int i = 0; i < 2; i++) {
+        uint32_t at = day + edges[i] * 3600;
+        if(at <= ts) at += 86400;
+        app->next_dim = MIN(app->next_dim, at);
+    }
+}
+
+// Level the policy asks for right now, capped by the battery governor.
+static uint8_t backlight_level(const App* app, uint32_t ts) {
+    const uint8_t cap = (app->power == PowerNormal) ? 0xFF : app->dim_level;
+
+    if(backlight_off(app)) return app->lit ? cap : 0x00;
+    if(app->backlight_mode == BacklightNightDim && in_hours(app->dim_from, app->dim_to, ts)) {
+        return MIN(app->dim_level, cap);
+    }
+    return cap;
+}
+
+static void handle_dim(App* app, uint32_t ts) {
+    set_backlight(app, backlight_level(app, ts));
+    schedule_dim(app, ts);
+}
+
+static void log_dim_estimate(const App* app) {
+    if(app->backlight_mode == BacklightOff) {
+        FURI_LOG_I(TAG, "backlight: off, %us per key press", app->light_secs);
+        return;
+    }
+    if(app->backlight_mode != BacklightNightDim || app->dim_from == app->dim_to) {
+        FURI_LOG_I(TAG, "backlight: always on");
+        return;
+    }
+    const uint32_t hours = (app->dim_to + 24 - app->dim_from) % 24;
+    const uint32_t saved_ua = BACKLIGHT_FULL_UA * (255U - app->dim_level) / 255U;
+    FURI_LOG_I(
+        TAG,
+        "backlight: dim %02u-%02u at %u/255, model saves ~%lu mAh/day",
+        app->dim_from,
+        app->dim_to,
+        app->dim_level,
+        (unsigned long)(saved_ua * hours / 1000));
+}
+
+// BacklightOff: light up for light_secs. One one-shot timer; every key press
+// while lit restarts it, and when it runs out light_cb queues AppEventDark.
+static void light_up(App* app) {
+    app->lit = true;
+    set_backlight(app, backlight_level(app, furi_hal_rtc_get_timestamp()));
+    furi_timer_restart(app->light, furi_ms_to_ticks(app->light_secs * 1000U));
+    retime(app);
+}
+
+static void handle_dark(App* app) {
+    if(!backlight_off(app)) return; // queued before a policy change
+    app->lit = false;
+    set_backlight(app, 0x00);
+    retime(app);
+}
+
+// ----------------------------------------------------------------------------
+// Battery governor
+// ----------------------------------------------------------------------------
+//
+// Battery charge and charging state are sampled once a minute (next_power,
+// scheduled like chimes). Only a level change does anything: the backlight
+// level is re-applied and retime picks the cheaper (or normal) redraw
+// schedule. Time at each level and the number of changes go in the perf
+// counters.
+//
+static void schedule_power(App* app, uint32_t ts) {
+    app->next_power = ts - ts % 60 + 60;
+}
+
+static Power power_level(Power now, uint8_t pct, bool charging) {
+    if(charging) return PowerNormal;
+
+    Power next = PowerNormal;
+    if(pct <= POWER_LOW_PCT) next = PowerLow;
+    if(pct <= POWER_CRITICAL_PCT) next = PowerCritical;
+
+    // Recovering: only step up once clear of the threshold by the margin.
+    if(next < now) {
+        const uint8_t limit = (now == PowerCritical) ? POWER_CRITICAL_PCT : POWER_LOW_PCT;
+        if(pct <= limit + POWER_HYSTERESIS) next = now;
+    }
+    return next;
+}
+
+static void handle_power(App* app, uint32_t ts) {
+    Perf* p = &app->perf;
+    const uint8_t pct = furi_hal_power_get_pct();
+    const bool charging = furi_hal_power_is_charging();
+
+    schedule_power(app, ts);
+    p->power_secs[app->power] += ts - p->power_since;
+    p->power_since = ts;
+
+    const Power next = power_level(app->power, pct, charging);
+    if(next == app->power) return;
+
+    FURI_LOG_I(
+        TAG, "power: %u%%%s, level %d -> %d", pct, charging ? " charging" : "", app->power, next);
+    app->power = next;
+    p->power_changes++;
+
+    if(!backlight_off(app)) app->lit = false;
+    handle_dim(app, ts);
+}
+
+// ----------------------------------------------------------------------------
+// Mode input handlers
+// ----------------------------------------------------------------------------
+//
+// Called from the main loop with the mutex held.
+//
+static void clock_input(App* app, const AppEvent* ev) {
+    const InputEvent* in = &ev->input;
+
+    // Toggle 12/24 hour on OK
+    if(in->type == InputTypeShort && in->key == InputKeyOk) {
+        app->mode_24h = !app->mode_24h;
+        app->pending |= PendingSettings;
+    }
+    // Toggle HH:MM / HH:MM:SS on UP
+    if(in->type == InputTypeShort && in->key == InputKeyUp) {
+        app->show_seconds = !app->show_seconds;
+        app->pending |= PendingSettings;
+    }
+    // Cycle clock faces on DOWN
+    if(in->type == InputTypeShort && in->key == InputKeyDown) {
+        app->face = (Face)((app->face + 1) % FaceCount);
+        app->pending |= PendingSettings;
+    }
+#if !BIGCLOCK_SETTINGS
+    // Toggle portrait / landscape on OK long (the settings menu has it otherwise).
+    if(in->type == InputTypeLong && in->key == InputKeyOk) {
+        app->portrait = !app->portrait;
+        app->pending |= PendingSettings;
+    }
+#endif
+    // Step through pages on LEFT/RIGHT.
+    if(in->type == InputTypeShort && (in->key == InputKeyLeft || in->key == InputKeyRight)) {
+        const int pages = PageZone + app->world.count;
+        const int step = (in->key == InputKeyRight) ? 1 : pages - 1;
+        app->page = (app->page + step) % pages;
+    }
+    // Cycle backlight on / night dimming / off on LEFT long.
+    if(in->type == InputTypeLong && in->key == InputKeyLeft) {
+        app->backlight_mode = (Backlight)((app->backlight_mode + 1) % BacklightCount);
+        app->pending |= PendingSettings;
+        if(backlight_off(app)) {
+            light_up(app); // stay lit for a moment so the change is visible
+        } else {
+            furi_timer_stop(app->light);
+            app->lit = false;
+            handle_dim(app, furi_hal_rtc_get_timestamp());
+        }
+        log_dim_estimate(app);
+    }
+    // Cycle chimes off / hourly / quarter-hour on RIGHT long, with a sample.
+    if(in->type == InputTypeLong && in->key == InputKeyRight) {
+        app->chime = (Chime)((app->chime + 1) % ChimeCount);
+        app->pending |= PendingSettings;
+        schedule_chime(app, furi_hal_rtc_get_timestamp());
+        if(app->chime == ChimeHourly) notification_message(app->notif, &sequence_chime_hour);
+        if(app->chime == ChimeQuarter) notification_message(app->notif, &sequence_chime_quarter);
+    }
+}
+
+static void stopwatch_input(App* app, const AppEvent* ev) {
+    const InputEvent* in = &ev->input;
+    Stopwatch* sw = &app->stopwatch;
+
+    // Start/stop and lap react to the press itself, using the stamped tick.
+    if(in->type == InputTypePress && in->key == InputKeyOk) {
+        stopwatch_toggle(sw, ev->tick);
+        retime(app);
+    }
+    if(in->type == InputTypePress && in->key == InputKeyRight && sw->running) {
+        stopwatch_lap(sw, ev->tick);
+        if(!app->laps) {
+            app->laps = malloc(sizeof(Laps));
+            laps_reset(app->laps);
+        }
+        Laps* laps = app->laps;
+        laps_add(laps, sw->last_lap);
+        FURI_LOG_I(
+            TAG,
+            "lap %lu: %lu ticks (best %lu, average %lu)",
+            (unsigned long)sw->laps,
+            (unsigned long)laps->last,
+            (unsigned long)laps->best,
+            (unsigned long)laps_avg(laps));
+    }
+    // Export the laps now (they are also exported on reset and at exit).
+    if(in->type == InputTypeShort && in->key == InputKeyDown && app->laps && !app->laps->saved) {
+        app->pending |= PendingLaps;
+    }
+    // Reset (only while stopped). Laps not yet exported are exported first,
+    // and the reset waits for that to succeed (flush_pending).
+    if(in->type == InputTypeShort && in->key == InputKeyLeft && !sw->running) {
+        if(app->laps && !app->laps->saved) {
+            app->pending |= PendingLaps | PendingLapsReset;
+        } else {
+            stopwatch_reset(sw);
+            if(app->laps) laps_reset(app->laps);
+        }
+    }
+}
+
+static void countdown_input(App* app, const AppEvent* ev) {
+    const InputEvent* in = &ev->input;
+    Countdown* cd = &app->countdown;
+
+    // Start/pause on the press, at the stamped tick. OK after expiry resets.
+    if(in->type == InputTypePress && in->key == InputKeyOk) {
+        if(cd->state == CountdownRunning) {
+            countdown_pause(cd, ev->tick);
+        } else if(cd->state == CountdownExpired) {
+            countdown_reset(cd);
+        } else {
+            countdown_start(cd, ev->tick);
+        }
+        retime(app);
+    }
+
+    // UP/DOWN +-1 min, RIGHT/LEFT +-10 s. Stopped timers reset to the preset first.
+    if(in->type == InputTypeShort && cd->state != CountdownRunning) {
+        int32_t delta = 0;
+        if(in->key == InputKeyUp) delta = 60;
+        if(in->key == InputKeyDown) delta = -60;
+        if(in->key == InputKeyRight) delta = 10;
+        if(in->key == InputKeyLeft) delta = -10;
+
+        if(delta) {
+            if(cd->state != CountdownIdle) countdown_reset(cd);
+            countdown_adjust(cd, delta);
+        }
+    }
+}
+
+static void chess_input(App* app, const AppEvent* ev) {
+    const InputEvent* in = &ev->input;
+    Chess* ch = &app->chess;
+
+    // LEFT/RIGHT presses were already charged in input_cb.
+
+    if(in->type == InputTypePress && in->key == InputKeyOk) {
+        chess_pause_toggle(ch, ev->tick);
+    }
+
+    // UP/DOWN +-1 min per side before the game. A paused or finished game resets first.
+    if(in->type == InputTypeShort && (in->key == InputKeyUp || in->key == InputKeyDown)) {
+        if(ch->paused || ch->flagged) chess_reset(ch);
+        chess_adjust(ch, in->key == InputKeyUp ? 60 : -60);
+    }
+
+    retime(app);
+}
+
+static void interval_input(App* app, const AppEvent* ev) {
+    const InputEvent* in = &ev->input;
+    Interval* iv = &app->interval;
+    const uint32_t ts = furi_hal_rtc_get_timestamp();
+
+    // OK starts/pauses (short, whole seconds are all it counts), and resets
+    // after the last phase. Saved each time, so the run carries on even if
+    // the app is never closed cleanly.
+    if(in->type == InputTypeShort && in->key == InputKeyOk) {
+        if(iv->state == IntervalRunning) {
+            interval_pause(iv, ts);
+        } else if(iv->state == IntervalDone) {
+            interval_reset(iv);
+        } else {
+            interval_start(iv, ts);
+            app->interval_rest = false;
+        }
+        app->pending |= PendingInterval;
+        retime(app);
+        return;
+    }
+
+    // UP/DOWN +-1 min of the work or rest time, LEFT/RIGHT pick which, OK long
+    // steps the cycle count. A stopped run resets first.
+    const bool edit = (in->type == InputTypeShort && in->key != InputKeyOk) ||
+                      (in->type == InputTypeLong && in->key == InputKeyOk);
+    if(!edit || iv->state == IntervalRunning) return;
+
+    if(iv->state != IntervalIdle) interval_reset(iv);
+    if(in->key == InputKeyLeft) app->interval_rest = false;
+    if(in->key == InputKeyRight) app->interval_rest = true;
+
+    const int32_t delta = (in->key == InputKeyUp) ? 60 : (in->key == InputKeyDown) ? -60 : 0;
+    interval_adjust(
+        iv,
+        app->interval_rest ? 0 : delta,
+        app->interval_rest ? delta : 0,
+        in->key == InputKeyOk ? 1 : 0);
+}
+
+// Played once when a countdown, chess clock or interval run reaches zero. notification_message
+// is async, so this never holds up the redraw of the final 00:00.
+static const NotificationSequence sequence_time_up = {
+    &message_red_255,
+    &message_vibro_on,
+    &message_note_c6,
+    &message_delay_250,
+    &message_vibro_off,
+    &message_sound_off,
+    &message_delay_100,
+    &message_vibro_on,
+    &message_note_c6,
+    &message_delay_250,
+    &message_vibro_off,
+    &message_sound_off,
+    &message_red_0,
+    NULL,
+};
+
+// Alarm: a few seconds of tone, vibration and LED.
+static const NotificationSequence sequence_alarm = {
+    &message_display_backlight_on,
+    &message_red_255,
+    &message_vibro_on,
+    &message_note_c6,
+    &message_delay_250,
+    &message_vibro_off,
+    &message_sound_off,
+    &message_delay_250,
+    &message_vibro_on,
+    &message_note_c6,
+    &message_delay_250,
+    &message_vibro_off,
+    &message_sound_off,
+    &message_delay_250,
+    &message_vibro_on,
+    &message_note_c6,
+    &message_delay_500,
+    &message_vibro_off,
+    &message_sound_off,
+    &message_red_0,
+    NULL,
+};
+
+// Recompute the next alarm, timing it for the perf log.
+static void schedule_alarms(App* app, uint32_t ts) {
+    const uint32_t t0 = furi_get_tick();
+    alarms_schedule(&app->alarms, ts);
+    FURI_LOG_D(
+        TAG,
+        "alarms: %u scheduled in %lu ticks, next at %lu",
+        app->alarms.count,
+        (unsigned long)(furi_get_tick() - t0),
+        (unsigned long)app->alarms.next);
+}
+
+// The per-tick check, main loop under the mutex: has anything the wake timer
+// covers fallen due by RTC time ts? A single compare each, against the
+// precomputed next times; handle_wake does the rest.
+static bool tick_due(App* app, uint32_t ts) {
+    app->perf.redraw_chime = ts >= app->next_chime;
+    return app->perf.redraw_chime || ts >= app->next_dim || ts >= app->next_power ||
+           alarms_due(&app->alarms, ts) || interval_due(&app->interval, ts);
+}
+
+static void handle_wake(App* app, const AppEvent* ev) {
+    const uint32_t ts = furi_hal_rtc_get_timestamp();
+    if(alarms_due(&app->alarms, ts)) {
+        notification_message(app->notif, &sequence_alarm);
+        schedule_alarms(app, ts);
+        if(backlight_off(app)) light_up(app);
+    }
+    if(ts >= app->next_chime) {
+        handle_chime(app, ts);
+    }
+    if(ts >= app->next_dim) {
+        handle_dim(app, ts);
+    }
+    if(ts >= app->next_power) {
+        handle_power(app, ts);
+    }
+
+    // Bring an expired timer on screen wherever we were.
+    bool expired = false;
+    if(countdown_poll(&app->countdown, ev->tick)) {
+        app->mode = ModeCountdown;
+        expired = true;
+    }
+    if(chess_poll(&app->chess, ev->tick)) {
+        app->mode = ModeChess;
+        expired = true;
+    }
+    if(interval_poll(&app->interval, ts)) {
+        if(app->interval.state == IntervalDone) {
+            app->mode = ModeInterval;
+            expired = true;
+            app->pending |= PendingInterval;
+        } else {
+            // A phase change is a chime: silent in quiet hours, the light still comes on.
+            if(!chime_quiet(app, ts)) notification_message(app->notif, &sequence_chime_hour);
+            if(backlight_off(app)) light_up(app);
+        }
+    }
+    if(expired) {
+        notification_message(app->notif, &sequence_time_up);
+        if(backlight_off(app)) light_up(app);
+    }
+    retime(app);
+}
+
+// A timer event through tick_run (tick.h).
+typedef struct {
+    App* app;
+    const AppEvent* ev;
+} TickCtx;
+
+static void tick_lock(void* ctx) {
+    furi_mutex_acquire(((TickCtx*)ctx)->app->mutex, FuriWaitForever);
+}
+
+static void tick_unlock(void* ctx) {
+    furi_mutex_release(((TickCtx*)ctx)->app->mutex);
+}
+
+static bool tick_check(void* ctx) {
+    TickCtx* t = ctx;
+    return t->ev->type == AppEventTick && tick_due(t->app, furi_hal_rtc_get_timestamp());
+}
+
+static void tick_redraw(void* ctx) {
+    TickCtx* t = ctx;
+    App* app = t->app;
+    if(t->ev->type == AppEventWake) handle_wake(app, t->ev);
+    if(t->ev->type == AppEventLight) light_up(app);
+    if(t->ev->type == AppEventDark) handle_dark(app);
+    if(refresh(app) && t->ev->type == AppEventTick) {
+        app->perf.redraw_req = t->ev->tick;
+        app->perf.redraw_pending = true;
+    }
+}
+
+static void tick_handle(void* ctx) {
+    TickCtx* t = ctx;
+    handle_wake(t->app, t->ev);
+    refresh(t->app);
+}
+
+static const TickSteps tick_steps = {
+    .lock = tick_lock,
+    .unlock = tick_unlock,
+    .due = tick_check,
+    .redraw = tick_redraw,
+    .handle = tick_handle,
+};
+
+#if BIGCLOCK_SETTINGS
+// ----------------------------------------------------------------------------
+// Settings menu
+// ----------------------------------------------------------------------------
+//
+// OK long in clock mode. The clock's ViewPort is switched off while the menu
+// (settings.c) runs on the main thread; the menu allocates everything it
+// needs when it opens and frees it before returning. Events queued meanwhile
+// may have been dropped, so anything that fell due is caught up afterwards.
+//
+static void open_settings(App* app, Gui* gui) {
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    SettingsValues v = {
+        .face = app->face,
+        .seconds = app->show_seconds,
+        .mode_24h = app->mode_24h,
+        .portrait = app->portrait,
+        .inverted = app->inverted,
+        .backlight = app->backlight_mode,
+        .dim_from = app->dim_from,
+        .dim_to = app->dim_to,
+        .dim_level = app->dim_level,
+        .light_secs = app->light_secs,
+        .chime = app->chime,
+        .quiet_from = app->quiet_from,
+        .quiet_to = app->quiet_to,
+        .stopwatch_fps = app->stopwatch_fps,
+        .alarms = &app->alarms,
+        .now = furi_hal_rtc_get_timestamp(),
+    };
+    furi_mutex_release(app->mutex);
+
+    const size_t heap = memmgr_get_free_heap();
+    view_port_enabled_set(app->vp, false);
+    const bool changed = settings_run(gui, &v);
+    view_port_enabled_set(app->vp, true);
+    FURI_LOG_I(
+        TAG, "settings: closed, heap %d bytes vs before", (int)(memmgr_get_free_heap() - heap));
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    const uint32_t ts = furi_hal_rtc_get_timestamp();
+    if(changed) {
+        const Backlight was = app->backlight_mode;
+        app->face = (Face)v.face;
+        app->show_seconds = v.seconds;
+        app->mode_24h = v.mode_24h;
+        app->portrait = v.portrait;
+        app->inverted = v.inverted;
+        app->backlight_mode = (Backlight)v.backlight;
+        app->dim_from = v.dim_from;
+        app->dim_to = v.dim_to;
+        app->dim_level = v.dim_level;
+        app->light_secs = v.light_secs;
+        app->chime = (Chime)v.chime;
+        app->quiet_from = v.quiet_from;
+        app->quiet_to = v.quiet_to;
+        app->stopwatch_fps = v.stopwatch_fps;
+        app->pending |= PendingSettings;
+        schedule_chime(app, ts);
+
+        if(app->backlight_mode != was && backlight_off(app)) {
+            light_up(app);
+        } else if(!backlight_off(app)) {
+            furi_timer_stop(app->light);
+            app->lit = false;
+            handle_dim(app, ts);
+        }
+        if(v.alarms_changed) {
+            app->pending |= PendingAlarms;
+            schedule_alarms(app, ts);
+        }
+    }
+    const AppEvent ev = {.type = AppEventWake, .tick = furi_get_tick()};
+    handle_wake(app, &ev);
+    refresh(app);
+    furi_mutex_release(app->mutex);
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// Deferred writes
+// ----------------------------------------------------------------------------
+//
+// Main loop, between events, with the mutex free. What app->pending asks for
+// is snapshotted under the mutex (the settings bytes, a copy of the alarm
+// list, the interval record, the laps' CSV text), written with it released,
+// and the outcome applied under it again.
+//
+static void flush_pending(App* app) {
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    const uint8_t pending = app->pending;
+    app->pending = 0;
+    uint8_t settings[SettingCount];
+    if(pending & PendingSettings) settings_bytes(app, settings);
+    Alarms alarms = {.items = NULL, .count = 0};
+    if(pending & PendingAlarms && app->alarms.count) {
+        alarms.count = app->alarms.count;
+        alarms.items = malloc(alarms.count * sizeof(Alarm));
+        memcpy(alarms.items, app->alarms.items, alarms.count * sizeof(Alarm));
+    }
+    IntervalRecord rec;
+    if(pending & PendingInterval) interval_save(&app->interval, &rec);
+    char* csv = NULL;
+    size_t len = 0;
+    uint32_t laps = 0;
+    if(pending & PendingLaps) {
+        csv = laps_csv_text(app->laps, furi_kernel_get_tick_frequency(), &len);
+        laps = app->laps->count;
+    }
+    furi_mutex_release(app->mutex);
+
+    if(pending & PendingSettings) write_settings(settings);
+    if(pending & PendingAlarms) {
+        alarms_save(&alarms);
+        alarms_free(&alarms);
+    }
+    if(pending & PendingInterval) write_interval(&rec);
+    if(!csv) return;
+    const bool ok = write_laps(csv, len);
+    free(csv);
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    Laps* l = app->laps;
+    log_laps_export(l, ok);
+    // A lap taken since the snapshot isn't in the file yet.
+    if(ok && l->count == laps) l->saved = true;
+    if(!ok) {
+        // Keep the laps (and the stopwatch) rather than lose them.
+        notification_message(app->notif, &sequence_error);
+    } else if(pending & PendingLapsReset) {
+        stopwatch_reset(&app->stopwatch);
+        laps_reset(l);
+    } else {
+        notification_message(app->notif, &sequence_success);
+    }
+    refresh(app);
+    furi_mutex_release(app->mutex);
 }
 
 // ----------------------------------------------------------------------------
@@ -262,15 +1984,53 @@ static void tick_cb(void* ctx) {
 // - Force backlight on while running.
 // - Redraw once per second.
 // - Exit on BACK (short press).
+// - OK toggles 12/24h, UP toggles seconds display, DOWN cycles faces (all saved).
+// - OK long press opens the settings menu (or toggles portrait without one).
+// - LEFT/RIGHT step through the time, date, sun and world clock pages.
+// - UP/DOWN long press switches between clock, stopwatch, countdown, chess and
+//   the interval timer.
+// - RIGHT long press cycles chimes (off, hourly, quarter-hour).
+// - LEFT long press cycles the backlight: on, night dimming, off until a key is pressed.
 //
 int32_t bigclock_app(void* p) {
     UNUSED(p);
 
     App app = {0};
-    app.mode_24h = load_mode_24h();
+    app.perf.start_tick = furi_get_tick();
+    app.perf.start_heap = memmgr_get_free_heap();
+    load_settings(&app);
+    app.mode = ModeClock;
+    app.swallow = InputKeyMAX;
+    countdown_init(&app.countdown, furi_kernel_get_tick_frequency(), COUNTDOWN_PRESET_DEFAULT);
+    chess_init(&app.chess, furi_kernel_get_tick_frequency(), CHESS_BASE_DEFAULT);
+    interval_init(
+        &app.interval, INTERVAL_WORK_DEFAULT, INTERVAL_REST_DEFAULT, INTERVAL_CYCLES_DEFAULT);
+    load_interval(&app, furi_hal_rtc_get_timestamp());
+    if(app.interval.state == IntervalRunning) app.mode = ModeInterval;
+
+    alarms_load(&app.alarms);
+    load_zones(&app);
+    load_location(&app);
+    schedule_alarms(&app, furi_hal_rtc_get_timestamp());
+    schedule_chime(&app, furi_hal_rtc_get_timestamp());
+    app.mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    clock_model_init(&app.model);
+    app.perf.model = &app.model;
+
+    // Offscreen frame lives on the heap; 1K is too much for the app stack.
+    app.frame = malloc(sizeof(Frame));
+    memset(app.frame, 0, sizeof(Frame));
+    app.drawn_layout = 0xFF; // no layout drawn yet, first draw is a full redraw
+    app.perf.minute = -1;
+
+    // Face state, the digital face's glyphs from the cache.
+    for(int i = 0; i < FaceCount; i++) {
+        if(clock_faces[i]) app.face_state[i] = clock_faces[i]->init();
+    }
+    app.portrait_state = portrait_face.init();
 
     // Input events sent from ViewPort callback to this thread.
-    app.q = furi_message_queue_alloc(8, sizeof(InputEvent));
+    app.q = furi_message_queue_alloc(8, sizeof(AppEvent));
 
     // Create fullscreen ViewPort and attach draw + input callbacks.
     app.vp = view_port_alloc();
@@ -284,41 +2044,118 @@ int32_t bigclock_app(void* p) {
     // Notification service controls system features like backlight.
     app.notif = furi_record_open(RECORD_NOTIFICATION);
 
-    // Keep backlight on so the clock stays visible (no auto-timeout).
-    notification_message(app.notif, &sequence_display_backlight_enforce_on);
+    // Keep backlight on so the clock stays visible (no auto-timeout), dimmed
+    // if the schedule says so.
+    // First battery sample, so a low battery is governed from the start.
+    app.perf.power_since = furi_hal_rtc_get_timestamp();
+    handle_power(&app, app.perf.power_since);
+
+    // A backlight that is off starts lit; the light timer takes it down once it exists.
+    app.lit = backlight_off(&app);
+    handle_dim(&app, furi_hal_rtc_get_timestamp());
+    log_dim_estimate(&app);
 
     // Once-per-second redraw so time and alive indicator update.
-    app.timer = furi_timer_alloc(tick_cb, FuriTimerTypePeriodic, app.vp);
-    furi_timer_start(app.timer, furi_ms_to_ticks(1000));
+    app.timer = furi_timer_alloc(tick_cb, FuriTimerTypePeriodic, &app);
+    app.wake = furi_timer_alloc(wake_cb, FuriTimerTypeOnce, &app);
+    app.light = furi_timer_alloc(light_cb, FuriTimerTypeOnce, &app);
+    if(app.lit) furi_timer_start(app.light, furi_ms_to_ticks(app.light_secs * 1000U));
+    retime(&app);
+
+    // First Readout for the face; draw_cb may already be running.
+    furi_mutex_acquire(app.mutex, FuriWaitForever);
+    refresh(&app);
+    furi_mutex_release(app.mutex);
 
-    // Main event loop: wait for input events and handle only BACK-to-exit.
-    InputEvent event;
+    // Main event loop: wait for input events (BACK exits, the rest go to the mode).
+    AppEvent event;
     while(true) {
+        flush_pending(&app);
         furi_message_queue_get(app.q, &event, FuriWaitForever);
+        const InputEvent* in = &event.input;
+
+        if(event.type != AppEventInput) {
+            // Whatever fell due is handled only after the redraw was asked for
+            // and the mutex let go, so a chime never holds up that second's frame.
+            TickCtx ctx = {&app, &event};
+            tick_run(&tick_steps, &ctx);
+            continue;
+        }
 
         // Exit on BACK short press.
-        if(event.type == InputTypeShort && event.key == InputKeyBack) {
+        if(in->type == InputTypeShort && in->key == InputKeyBack) {
             break;
         }
-        // Toggle 12/24 hour on OK
-        if(event.type == InputTypeShort && event.key == InputKeyOk) {
-            app.mode_24h = !app.mode_24h;
-            save_mode_24h(app.mode_24h);
-            view_port_update(app.vp);
+
+#if BIGCLOCK_SETTINGS
+        if(app.mode == ModeClock && in->type == InputTypeLong && in->key == InputKeyOk) {
+            open_settings(&app, gui);
+            continue;
+        }
+#endif
+
+        furi_mutex_acquire(app.mutex, FuriWaitForever);
+
+        const uint32_t lag = furi_get_tick() - event.tick;
+        if(lag > app.perf.input_lag) app.perf.input_lag = lag;
+
+        // Keys keep a woken backlight on.
+        if(app.lit) furi_timer_restart(app.light, furi_ms_to_ticks(app.light_secs * 1000U));
+
+        if(in->type == InputTypeLong && (in->key == InputKeyUp || in->key == InputKeyDown)) {
+            // Cycle modes on UP/DOWN long press.
+            const int step = (in->key == InputKeyUp) ? 1 : ModeCount - 1;
+            app.mode = (Mode)((app.mode + step) % ModeCount);
+            retime(&app);
+        } else if(in->type == InputTypeLong && in->key == InputKeyBack) {
+            // Invert the display on BACK long, in every mode.
+            app.inverted = !app.inverted;
+            app.pending |= PendingSettings;
+        } else if(app.mode == ModeStopwatch) {
+            stopwatch_input(&app, &event);
+        } else if(app.mode == ModeCountdown) {
+            countdown_input(&app, &event);
+        } else if(app.mode == ModeChess) {
+            chess_input(&app, &event);
+        } else if(app.mode == ModeInterval) {
+            interval_input(&app, &event);
+        } else {
+            clock_input(&app, &event);
         }
+
+        refresh(&app);
+        furi_mutex_release(app.mutex);
     }
 
-    // Stop periodic redraws.
+    // Stop periodic redraws and wakeups.
     furi_timer_stop(app.timer);
     furi_timer_free(app.timer);
+    furi_timer_stop(app.wake);
+    furi_timer_free(app.wake);
+    furi_timer_stop(app.light);
+    furi_timer_free(app.light);
 
     // Remove ViewPort and release GUI record.
     gui_remove_view_port(gui, app.vp);
     view_port_free(app.vp);
     furi_record_close(RECORD_GUI);
 
-    // Free input queue.
+    // Free input queue, offscreen frame and glyphs.
     furi_message_queue_free(app.q);
+    free(app.frame);
+    free(app.inverse);
+    free(app.date_page);
+    free(app.sun_page);
+    export_laps(&app);
+    free(app.laps);
+    save_interval(&app);
+    for(int i = 0; i < FaceCount; i++) {
+        if(app.face_state[i]) clock_faces[i]->deinit(app.face_state[i]);
+    }
+    portrait_face.deinit(app.portrait_state);
+    glyph_cache_clear();
+    alarms_free(&app.alarms);
+    furi_mutex_free(app.mutex);
 
     // Restore normal backlight behavior and clear any display overrides.
     notification_message(app.notif, &sequence_display_backlight_enforce_auto);
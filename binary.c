@@ -0,0 +1,113 @@
+#include "binary.h"
+#include "layout.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// At 128x64 squares are 13 px with 3 px between bits and digits, 8 px between
+// pairs. Four rows fill the height; the six columns fit left of the gutter.
+#define CELL BIN_CELL
+
+static const uint8_t col_x[BINARY_COLS] = {
+    BIN_COL_X(0), BIN_COL_X(1), BIN_COL_X(2), BIN_COL_X(3), BIN_COL_X(4), BIN_COL_X(5)};
+
+// Row of each bit, bit 0 at the bottom.
+static const uint8_t bit_y[4] = {BIN_ROW_Y(0), BIN_ROW_Y(1), BIN_ROW_Y(2), BIN_ROW_Y(3)};
+
+// Bits each column can use: hours tens 0..2, minute/second tens 0..5.
+static const uint8_t col_bits[BINARY_COLS] = {0x3, 0xF, 0x7, 0xF, 0x7, 0xF};
+
+void binary_column(Frame* f, int col, int8_t* drawn, int d) {
+    const uint8_t bits = col_bits[col];
+    const uint8_t next = (uint8_t)((d < 0) ? 0 : d) & bits;
+    const int x = col_x[col];
+    uint8_t diff;
+
+    if(*drawn < 0) {
+        // Fresh column: outline every square, then fill the lit ones.
+        for(int b = 0; b < 4; b++) {
+            if(bits & (1 << b)) frame_outline(f, x, bit_y[b], CELL, CELL);
+        }
+        diff = next;
+    } else {
+        diff = ((uint8_t)*drawn ^ next) & bits;
+    }
+
+    // The outlines stay put; a flipped bit only fills or clears the inside.
+    for(int b = 0; diff; b++, diff >>= 1) {
+        if(diff & 1) frame_box(f, x + 1, bit_y[b] + 1, CELL - 2, CELL - 2, (next >> b) & 1);
+    }
+    *drawn = (int8_t)next;
+}
+
+// ----------------------------------------------------------------------------
+// ClockFace
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    int8_t digit[BINARY_COLS]; // for the last Readout
+    int8_t drawn[BINARY_COLS]; // in the frame, -1 = not drawn
+    uint8_t cols;              // columns shown: 4, or 6 with seconds
+    bool fresh;                // no Readout yet
+} BinaryFace;
+
+static FaceRect column_rect(int col) {
+    return (FaceRect){col_x[col], bit_y[3], CELL, (uint8_t)(bit_y[0] + CELL - bit_y[3])};
+}
+
+static void* binary_init(void) {
+    BinaryFace* b = malloc(sizeof(BinaryFace));
+    memset(b, 0, sizeof(BinaryFace));
+    b->fresh = true;
+    return b;
+}
+
+static void binary_deinit(void* face) {
+    free(face);
+}
+
+static int binary_on_tick(void* face, const Readout* r, FaceRect* damage, uint8_t* next_s) {
+    BinaryFace* b = face;
+    const int8_t digit[BINARY_COLS] = {
+        r->big[0], r->big[1], r->big[2], r->big[3], r->small_digit[0], r->small_digit[1]};
+    const uint8_t cols = r->small ? BINARY_COLS : BINARY_COLS - 2;
+    *next_s = r->small && r->small_digit[0] >= 0 ? 1 : r->minute_s;
+
+    int n = 0;
+    if(b->fresh || cols != b->cols) {
+        damage[n++] = face_screen;
+    } else {
+        // Blank draws as 0, so only a change in the drawn bits counts.
+        for(int i = 0; i < cols; i++) {
+            const uint8_t from = (uint8_t)(b->digit[i] < 0 ? 0 : b->digit[i]) & col_bits[i];
+            const uint8_t to = (uint8_t)(digit[i] < 0 ? 0 : digit[i]) & col_bits[i];
+            if(from != to) damage[n++] = column_rect(i);
+        }
+    }
+
+    memcpy(b->digit, digit, sizeof(digit));
+    b->cols = cols;
+    b->fresh = false;
+    return n;
+}
+
+static void binary_render(void* face, Frame* f, const FaceRect* region) {
+    BinaryFace* b = face;
+
+    if(region->w == FRAME_W && region->h == FRAME_H) {
+        frame_clear(f);
+        memset(b->drawn, -1, sizeof(b->drawn));
+    }
+
+    for(int i = 0; i < b->cols; i++) {
+        const FaceRect at = column_rect(i);
+        if(face_overlaps(region, &at)) binary_column(f, i, &b->drawn[i], b->digit[i]);
+    }
+}
+
+const ClockFace binary_face = {
+    .init = binary_init,
+    .deinit = binary_deinit,
+    .on_tick = binary_on_tick,
+    .render = binary_render,
+};
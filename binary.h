@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "face.h"
+#include "frame.h"
+
+// ----------------------------------------------------------------------------
+// Binary (BCD) face
+// ----------------------------------------------------------------------------
+//
+// One column per digit (HH MM SS), one square per bit, bit 0 at the bottom.
+// Lit bits are filled squares, clear bits are outlines. Square positions
+// come from a fixed layout table, and a column is redrawn from the XOR of
+// its old and new value, so only the squares whose bit flipped are touched
+// (and an unchanged column costs nothing).
+//
+#define BINARY_COLS 6
+
+// Bring column col (0..5, H tens .. S ones) in f from *drawn to digit d.
+// d < 0 draws as 0 (blank leading hour digit). *drawn < 0 = nothing drawn yet.
+void binary_column(Frame* f, int col, int8_t* drawn, int d);
+
+// The binary face (face.h): HH MM, plus SS when the Readout has small digits.
+// Damage is the column of each digit that changed.
+extern const ClockFace binary_face;
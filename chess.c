@@ -0,0 +1,69 @@
+#include "chess.h"
+
+void chess_init(Chess* ch, uint32_t hz, uint32_t base_s) {
+    countdown_init(&ch->side[0], hz, base_s);
+    countdown_init(&ch->side[1], hz, base_s);
+    chess_reset(ch);
+}
+
+void chess_reset(Chess* ch) {
+    countdown_reset(&ch->side[0]);
+    countdown_reset(&ch->side[1]);
+    ch->turn = -1;
+    ch->paused = false;
+    ch->flagged = false;
+    ch->reported = false;
+    ch->switches = 0;
+}
+
+void chess_adjust(Chess* ch, int32_t delta_s) {
+    if(ch->turn >= 0) return;
+
+    countdown_adjust(&ch->side[0], delta_s);
+    countdown_adjust(&ch->side[1], delta_s);
+}
+
+bool chess_press(Chess* ch, int side, uint32_t at) {
+    if(ch->paused || ch->flagged) return false;
+
+    // First press starts the opponent's clock. After that only the side to
+    // move may end the turn; the other key is ignored.
+    if(ch->turn >= 0) {
+        if(ch->turn != side) return false;
+        // Out of time before the press (chess_poll just hadn't got there): the
+        // side has lost on time and the turn doesn't pass.
+        if(countdown_poll(&ch->side[side], at)) {
+            ch->flagged = true;
+            return false;
+        }
+        countdown_pause(&ch->side[side], at);
+        ch->switches++;
+    }
+
+    ch->turn = (int8_t)!side;
+    countdown_start(&ch->side[ch->turn], at);
+    return true;
+}
+
+void chess_pause_toggle(Chess* ch, uint32_t at) {
+    if(ch->turn < 0 || ch->flagged) return;
+
+    if(ch->paused) {
+        countdown_start(&ch->side[ch->turn], at);
+    } else {
+        countdown_pause(&ch->side[ch->turn], at);
+    }
+    ch->paused = !ch->paused;
+}
+
+bool chess_running(const Chess* ch) {
+    return ch->turn >= 0 && !ch->paused && !ch->flagged;
+}
+
+bool chess_poll(Chess* ch, uint32_t now) {
+    if(chess_running(ch) && countdown_poll(&ch->side[ch->turn], now)) ch->flagged = true;
+    if(!ch->flagged || ch->reported) return false;
+
+    ch->reported = true;
+    return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "countdown.h"
+
+// ----------------------------------------------------------------------------
+// Chess clock
+// ----------------------------------------------------------------------------
+//
+// Two Countdowns, one per side; at most one runs. A player ends their turn by
+// pressing their key, which pauses their clock and starts the opponent's at
+// the same tick, so no time is lost or double-charged across the switch.
+//
+typedef struct {
+    Countdown side[2];
+    int8_t turn;        // side whose clock runs (or would run), -1 = not started
+    bool paused;
+    bool flagged;       // a side ran out of time
+    bool reported;      // ...and chess_poll has said so
+    uint32_t switches;  // turns ended since reset
+} Chess;
+
+void chess_init(Chess* ch, uint32_t hz, uint32_t base_s);
+
+// Both sides back to the base time, nobody to move.
+void chess_reset(Chess* ch);
+
+// Change the base time by delta_s and reset. Ignored once the game started.
+void chess_adjust(Chess* ch, int32_t delta_s);
+
+// `side` pressed their key at tick `at`. Starts the game (opponent to move)
+// or ends that side's turn. True if a clock switched. A side to move whose
+// time ran out by `at` is flagged instead, and keeps the turn.
+bool chess_press(Chess* ch, int side, uint32_t at);
+
+// Pause or resume the running side at tick `at`.
+void chess_pause_toggle(Chess* ch, uint32_t at);
+
+bool chess_running(const Chess* ch);
+
+// Running side ran out as of `now`: stop the game. True once per flag, on
+// the first poll that sees it (also for a flag raised by chess_press).
+bool chess_poll(Chess* ch, uint32_t now);
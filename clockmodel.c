@@ -0,0 +1,82 @@
+#include "clockmodel.h"
+
+#include <stddef.h>
+
+void clock_model_init(ClockModel* m) {
+    *m = (ClockModel){.second = UINT32_MAX};
+}
+
+static void decode_minute(DisplayState* s, uint32_t second_of_day, uint8_t settings) {
+    const int H24 = (int)(second_of_day / 3600);
+    const int M = (int)(second_of_day / 60 % 60);
+    const bool show_24 = settings & CLOCK_24H;
+
+    int H = H24; // display hour
+    if(!show_24) {
+        // 12-hour clock: 0 -> 12, 13 -> 1, etc.
+        H = H24 % 12;
+        if(H == 0) H = 12;
+    }
+
+    // Hours tens digit is blank for 1..9 in 12h mode; in 24h mode show 0 for 00..09.
+    s->big[0] = (int8_t)((!show_24 && H < 10) ? -1 : H / 10);
+    s->big[1] = (int8_t)(H % 10);
+    s->big[2] = (int8_t)(M / 10);
+    s->big[3] = (int8_t)(M % 10);
+
+    s->flags = 0;
+    if(settings & CLOCK_SECONDS) s->flags |= DISPLAY_SMALL;
+    if(H24 >= 12) s->flags |= DISPLAY_PM;
+    if(show_24) s->flags |= DISPLAY_24H;
+}
+
+static void decode_seconds(DisplayState* s, uint32_t second_of_day, uint8_t settings) {
+    const int S = (int)(second_of_day % 60);
+    if(settings & CLOCK_FRUGAL) {
+        // Same layout, seconds blanked: the frame is only redrawn each minute.
+        s->sec[0] = s->sec[1] = -1;
+        s->grid = 0;
+        return;
+    }
+    s->sec[0] = (int8_t)(S / 10);
+    s->sec[1] = (int8_t)(S % 10);
+    s->grid = (int8_t)(S + 1);
+}
+
+const DisplayState* clock_model(ClockModel* m, uint32_t second_of_day, uint8_t settings) {
+    second_of_day %= 86400;
+    if(m->second == second_of_day && m->settings == settings) {
+        m->hits++;
+        return &m->state;
+    }
+
+    if(m->second != UINT32_MAX && m->second / 60 == second_of_day / 60 &&
+       m->settings == settings) {
+        m->minute_hits++;
+    } else {
+        m->misses++;
+        decode_minute(&m->state, second_of_day, settings);
+    }
+    decode_seconds(&m->state, second_of_day, settings);
+    m->second = second_of_day;
+    m->settings = settings;
+    return &m->state;
+}
+
+void display_readout(const DisplayState* s, Readout* r) {
+    for(int i = 0; i < 4; i++) r->big[i] = s->big[i];
+    r->small = s->flags & DISPLAY_SMALL;
+    r->small_digit[0] = s->sec[0];
+    r->small_digit[1] = s->sec[1];
+    r->grid = s->grid;
+
+    // AM/PM indicator (LCD-style): two fixed labels, only one is "lit".
+    // They must not occupy the same location.
+    if(s->flags & DISPLAY_24H) {
+        r->label[0] = "24";
+    } else if(s->flags & DISPLAY_PM) {
+        r->label[2] = "PM";
+    } else {
+        r->label[1] = "AM";
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "face.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Clock model
+// ----------------------------------------------------------------------------
+//
+// What the clock shows for a second of the day, as a pure function of that
+// second and a few settings: digits, blanking, the seconds grid and AM/PM.
+// No furi, no GUI: builds and runs as-is on a host. Faces get it through
+// display_readout; the app never decodes the time anywhere else.
+//
+// clock_model memoizes: asked for the same second again (draw_cb after the
+// tick that asked for the redraw) it returns the stored state untouched, and
+// within the same minute it redoes only the seconds fields.
+//
+#define CLOCK_24H     (1 << 0)   // settings: 24-hour digits
+#define CLOCK_SECONDS (1 << 1)   // seconds as two small digits instead of the grid
+#define CLOCK_FRUGAL  (1 << 2)   // seconds blanked (minute-only redraws)
+
+#define DISPLAY_SMALL (1 << 0)   // DisplayState.flags: small seconds digits shown
+#define DISPLAY_PM    (1 << 1)
+#define DISPLAY_24H   (1 << 2)
+
+// 8 bytes; equal states draw identical frames.
+typedef struct {
+    int8_t big[4];     // H H M M, -1 = blank (12-hour leading zero)
+    int8_t sec[2];     // seconds digits, -1 = blanked
+    int8_t grid;       // seconds ticks lit, 1..60, 0 = blanked
+    uint8_t flags;     // DISPLAY_*
+} DisplayState;
+
+typedef struct {
+    uint32_t second;       // second of day held in state, UINT32_MAX = none
+    uint8_t settings;
+    DisplayState state;
+    uint32_t hits;         // same second and settings: returned as is
+    uint32_t minute_hits;  // same minute: only the seconds redone
+    uint32_t misses;       // decoded from scratch
+} ClockModel;
+
+void clock_model_init(ClockModel* m);
+
+// The state for second_of_day (0..86399) under settings (CLOCK_*). The
+// pointer stays valid until the next call on m.
+const DisplayState* clock_model(ClockModel* m, uint32_t second_of_day, uint8_t settings);
+
+// The Readout faces draw for a state: big digits, gutter, AM/PM or 24 label.
+void display_readout(const DisplayState* s, Readout* r);
@@ -0,0 +1,74 @@
+#include "countdown.h"
+
+#define COUNTDOWN_MAX_S (99 * 3600 + 59 * 60 + 59)
+
+void countdown_init(Countdown* cd, uint32_t hz, uint32_t preset_s) {
+    cd->hz = hz;
+    cd->preset = preset_s;
+    countdown_reset(cd);
+}
+
+void countdown_reset(Countdown* cd) {
+    cd->state = CountdownIdle;
+    cd->left = cd->preset * cd->hz;
+    cd->deadline = 0;
+}
+
+void countdown_adjust(Countdown* cd, int32_t delta_s) {
+    if(cd->state != CountdownIdle) return;
+
+    int32_t s = (int32_t)cd->preset + delta_s;
+    if(s < 1) s = 1;
+    if(s > COUNTDOWN_MAX_S) s = COUNTDOWN_MAX_S;
+    cd->preset = (uint32_t)s;
+    cd->left = cd->preset * cd->hz;
+}
+
+void countdown_start(Countdown* cd, uint32_t at) {
+    if(cd->state != CountdownIdle && cd->state != CountdownPaused) return;
+
+    cd->deadline = at + cd->left;
+    cd->state = CountdownRunning;
+}
+
+void countdown_pause(Countdown* cd, uint32_t at) {
+    if(cd->state != CountdownRunning) return;
+
+    cd->left = countdown_left(cd, at);
+    cd->state = CountdownPaused;
+}
+
+uint32_t countdown_left(const Countdown* cd, uint32_t now) {
+    switch(cd->state) {
+    case CountdownRunning: {
+        // Signed difference keeps this right across tick counter wraparound.
+        const int32_t d = (int32_t)(cd->deadline - now);
+        return d > 0 ? (uint32_t)d : 0;
+    }
+    case CountdownExpired:
+        return 0;
+    default:
+        return cd->left;
+    }
+}
+
+uint32_t countdown_display_s(const Countdown* cd, uint32_t now) {
+    return (countdown_left(cd, now) + cd->hz - 1) / cd->hz;
+}
+
+bool countdown_poll(Countdown* cd, uint32_t now) {
+    if(cd->state != CountdownRunning || countdown_left(cd, now) > 0) return false;
+
+    cd->state = CountdownExpired;
+    return true;
+}
+
+uint32_t countdown_next_wake(const Countdown* cd, uint32_t now) {
+    if(cd->state != CountdownRunning) return 0;
+
+    // The display shows ceil(left / hz); it changes when left crosses the next
+    // lower multiple of hz. At left == 0 that is the expiry itself.
+    const uint32_t left = countdown_left(cd, now);
+    if(left == 0) return 1;
+    return ((left - 1) % cd->hz) + 1;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Countdown timer
+// ----------------------------------------------------------------------------
+//
+// While running, the only state is an absolute deadline. Remaining time is
+// always deadline - now, so late or missed timer callbacks can delay a redraw
+// but never add error. Ticks come from the caller (furi_get_tick()).
+//
+typedef enum {
+    CountdownIdle,      // showing the preset, editable
+    CountdownRunning,
+    CountdownPaused,
+    CountdownExpired,
+} CountdownState;
+
+typedef struct {
+    CountdownState state;
+    uint32_t hz;        // ticks per second
+    uint32_t preset;    // seconds, restored by reset
+    uint32_t left;      // ticks left (Idle/Paused)
+    uint32_t deadline;  // tick the countdown ends at (Running)
+} Countdown;
+
+void countdown_init(Countdown* cd, uint32_t hz, uint32_t preset_s);
+
+// Back to Idle with the preset loaded.
+void countdown_reset(Countdown* cd);
+
+// Change the preset by delta_s, clamped to 1 s .. 99:59:59. Idle only.
+void countdown_adjust(Countdown* cd, int32_t delta_s);
+
+// Start or resume at tick `at`.
+void countdown_start(Countdown* cd, uint32_t at);
+
+// Pause at tick `at`.
+void countdown_pause(Countdown* cd, uint32_t at);
+
+// Ticks left as of `now`.
+uint32_t countdown_left(const Countdown* cd, uint32_t now);
+
+// Seconds to display: remaining time rounded up, so 0 shows only at expiry.
+uint32_t countdown_display_s(const Countdown* cd, uint32_t now);
+
+// Running -> Expired once the deadline has passed. True on that transition.
+bool countdown_poll(Countdown* cd, uint32_t now);
+
+// Ticks until the displayed second next changes (0 if not running).
+uint32_t countdown_next_wake(const Countdown* cd, uint32_t now);
@@ -0,0 +1,42 @@
+#include "datepage.h"
+#include "glyphs.h"
+#include "layout.h"
+
+// Digit geometry and spacing (layout.h). Both rows are centered left of the gutter.
+#define DIGIT_W DATE_DIGIT_W
+#define DIGIT_H DATE_DIGIT_H
+#define DIGIT_T DATE_DIGIT_T
+#define GAP     DATE_GAP
+#define DOT     DATE_DOT
+#define AREA_W  DATE_AREA_W
+
+static void draw_digits(Frame* f, const DigitSet* set, int x, int y, const int* d, int n) {
+    for(int i = 0; i < n; i++) {
+        frame_blit(f, x, y, set->w, set->h, digitset_glyph(set, d[i]));
+        x += set->w + GAP;
+    }
+}
+
+void datepage_render(Frame* f, int day, int month, int year) {
+    const DigitSet* set = digitset_get(DIGIT_W, DIGIT_H, DIGIT_T);
+    frame_clear(f);
+
+    // DD.MM on top.
+    const int dd[2] = {day / 10, day % 10};
+    const int mm[2] = {month / 10, month % 10};
+    const int top_w = DATE_TOP_W;
+    const int x0 = (AREA_W - top_w) / 2;
+    const int x_dot = x0 + 2 * (DIGIT_W + GAP);
+
+    draw_digits(f, set, x0, 0, dd, 2);
+    frame_box(f, x_dot, DIGIT_H - DOT, DOT, DOT, true);
+    draw_digits(f, set, x_dot + DOT + GAP, 0, mm, 2);
+
+    // YYYY underneath.
+    const int yyyy[4] = {(year / 1000) % 10, (year / 100) % 10, (year / 10) % 10, year % 10};
+    const int bottom_w = 4 * DIGIT_W + 3 * GAP;
+
+    draw_digits(f, set, (AREA_W - bottom_w) / 2, FRAME_H - DIGIT_H, yyyy, 4);
+
+    digitset_put(set);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "frame.h"
+
+// ----------------------------------------------------------------------------
+// Date page
+// ----------------------------------------------------------------------------
+//
+// DD.MM over YYYY in medium digits. Nothing on it changes more than once a
+// day, so the caller renders it into a cached Frame when the date changes
+// (or on first view) and blits that Frame on every other draw. The glyphs are
+// only needed while rendering, so they are rasterized and freed right here.
+//
+
+// Render the page for the given date into f (cleared first).
+void datepage_render(Frame* f, int day, int month, int year);
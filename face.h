@@ -0,0 +1,71 @@
+#pragma once
+
+#include "frame.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Readouts
+// ----------------------------------------------------------------------------
+//
+// Each mode turns its state into a Readout: which digits go where and which
+// gutter labels are lit. Faces render any Readout the same way.
+//
+typedef struct {
+    int8_t big[4];          // big digits left to right, -1 = blank
+    bool small;             // gutter shows two small digits instead of the grid
+    int8_t small_digit[2];  // top, bottom
+    int8_t grid;            // ticks lit in the seconds grid, 1..60
+    const char* label[3];   // gutter labels at LABEL_Y(0..2), NULL = unlit
+    char label_buf[4];      // storage for a formatted label
+    uint8_t minute_s;       // clock: seconds until the shown minute changes (1..60), else 0
+} Readout;
+
+// Seconds until a digit layout showing r next changes as time passes: every
+// second while seconds (digits or grid) are on screen, else at the minute.
+static inline uint8_t readout_next_s(const Readout* r) {
+    return (r->small ? r->small_digit[0] >= 0 : r->grid > 0) ? 1 : r->minute_s;
+}
+
+// ----------------------------------------------------------------------------
+// Clock faces
+// ----------------------------------------------------------------------------
+//
+// A face paints Readouts into the persistent Frame in two steps. on_tick
+// (main loop) takes the new Readout and reports the rectangles whose pixels
+// it changes, drawing nothing. The core asks the GUI for a redraw only when
+// something was reported, and draw_cb then calls render for just those
+// rectangles. A face that reports tightly gets skipped redraws and partial
+// updates without doing anything else.
+//
+// uint8_t coordinates: layout.h checks that the frame fits.
+typedef struct {
+    uint8_t x, y, w, h;
+} FaceRect;
+
+#define FACE_DAMAGE_MAX 8
+
+static const FaceRect face_screen = {0, 0, FRAME_W, FRAME_H};
+
+static inline bool face_overlaps(const FaceRect* a, const FaceRect* b) {
+    return a->x < b->x + b->w && b->x < a->x + a->w && a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+typedef struct {
+    // Allocate the face's state (glyphs, last Readout).
+    void* (*init)(void);
+    void (*deinit)(void* face);
+
+    // A new Readout. Writes up to FACE_DAMAGE_MAX rectangles to damage and
+    // returns how many; 0 means the frame would not change. *next_s is how
+    // many seconds from now the face's pixels next change with the time: 1
+    // while something moves every second, r->minute_s while nothing finer
+    // than the minute is shown, 0 when r isn't a clock (the mode decides).
+    int (*on_tick)(void* face, const Readout* r, FaceRect* damage, uint8_t* next_s);
+
+    // Repaint every pixel of region for the last Readout. region is a
+    // rectangle on_tick reported, or face_screen when the frame holds
+    // something else (first draw, layout change).
+    void (*render)(void* face, Frame* f, const FaceRect* region);
+} ClockFace;
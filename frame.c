@@ -0,0 +1,134 @@
+#include "frame.h"
+
+#include <furi.h>
+#include <string.h>
+
+void frame_clear(Frame* f) {
+    memset(f->px, 0, sizeof(f->px));
+    f->px_written += FRAME_W * FRAME_H;
+}
+
+void bitmap_box(uint8_t* px, int bw, int bh, int x, int y, int w, int h, bool on) {
+    // Clip to the bitmap.
+    if(x < 0) {
+        w += x;
+        x = 0;
+    }
+    if(y < 0) {
+        h += y;
+        y = 0;
+    }
+    if(x + w > bw) w = bw - x;
+    if(y + h > bh) h = bh - y;
+    if(w <= 0 || h <= 0) return;
+
+    // Work a byte at a time: partial masks at both ends, whole bytes between.
+    const int stride = BITMAP_STRIDE(bw);
+    const int x1 = x + w - 1;
+    const int b0 = x >> 3;
+    const int b1 = x1 >> 3;
+    const uint8_t m0 = (uint8_t)(0xFF << (x & 7));
+    const uint8_t m1 = (uint8_t)(0xFF >> (7 - (x1 & 7)));
+
+    for(int yy = y; yy < y + h; yy++) {
+        uint8_t* row = &px[yy * stride];
+
+        if(b0 == b1) {
+            const uint8_t m = m0 & m1;
+            row[b0] = on ? (row[b0] | m) : (row[b0] & (uint8_t)~m);
+            continue;
+        }
+
+        row[b0] = on ? (row[b0] | m0) : (row[b0] & (uint8_t)~m0);
+        if(b1 - b0 > 1) memset(&row[b0 + 1], on ? 0xFF : 0x00, b1 - b0 - 1);
+        row[b1] = on ? (row[b1] | m1) : (row[b1] & (uint8_t)~m1);
+    }
+}
+
+void frame_box(Frame* f, int x, int y, int w, int h, bool on) {
+    // Count only the visible part.
+    const int cw = MIN(x + w, FRAME_W) - MAX(x, 0);
+    const int ch = MIN(y + h, FRAME_H) - MAX(y, 0);
+    if(cw <= 0 || ch <= 0) return;
+
+    f->px_written += (uint32_t)(cw * ch);
+    bitmap_box(f->px, FRAME_W, FRAME_H, x, y, w, h, on);
+}
+
+void frame_blit(Frame* f, int x, int y, int w, int h, const uint8_t* bits) {
+    const int stride = BITMAP_STRIDE(w);
+
+    f->px_written += (uint32_t)(w * h);
+
+    for(int r = 0; r < h; r++) {
+        const int yy = y + r;
+        if(yy < 0 || yy >= FRAME_H) continue;
+
+        uint8_t* row = &f->px[yy * FRAME_STRIDE];
+        const uint8_t* src = &bits[r * stride];
+
+        // Each source byte lands on at most two frame bytes.
+        for(int sb = 0; sb < stride; sb++) {
+            const int dx = x + sb * 8;
+            const int n = MIN(8, w - sb * 8);
+            const uint8_t mask = (uint8_t)(0xFF >> (8 - n));
+            const uint8_t v = src[sb] & mask;
+            const int db = dx >> 3;
+            const int shift = dx & 7;
+
+            if(dx >= 0 && db < FRAME_STRIDE) {
+                row[db] = (row[db] & (uint8_t)~(mask << shift)) | (uint8_t)(v << shift);
+            }
+            if(shift && n + shift > 8 && dx + 8 >= 0 && db + 1 < FRAME_STRIDE) {
+                row[db + 1] = (row[db + 1] & (uint8_t)~(mask >> (8 - shift))) |
+                              (uint8_t)(v >> (8 - shift));
+            }
+        }
+    }
+}
+
+void frame_copy(Frame* f, const Frame* src) {
+    memcpy(f->px, src->px, sizeof(f->px));
+    f->px_written += FRAME_W * FRAME_H;
+}
+
+void frame_invert(Frame* dst, const Frame* src) {
+    for(size_t i = 0; i < COUNT_OF(src->words); i++) {
+        dst->words[i] = ~src->words[i];
+    }
+}
+
+void frame_line(Frame* f, int x0, int y0, int x1, int y1) {
+    const int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    const int dy = (y1 > y0) ? y0 - y1 : y1 - y0; // negative
+    const int sx = (x0 < x1) ? 1 : -1;
+    const int sy = (y0 < y1) ? 1 : -1;
+    int err = dx + dy;
+
+    while(true) {
+        if(x0 >= 0 && x0 < FRAME_W && y0 >= 0 && y0 < FRAME_H) {
+            const int i = y0 * FRAME_STRIDE + (x0 >> 3);
+            f->px[i] |= (uint8_t)(1 << (x0 & 7));
+            f->px_written++;
+        }
+
+        if(x0 == x1 && y0 == y1) break;
+        const int e2 = 2 * err;
+        if(e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if(e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void frame_outline(Frame* f, int x, int y, int w, int h) {
+    if(w <= 0 || h <= 0) return;
+    frame_box(f, x, y, w, 1, true);
+    frame_box(f, x, y + h - 1, w, 1, true);
+    frame_box(f, x, y + 1, 1, h - 2, true);
+    frame_box(f, x + w - 1, y + 1, 1, h - 2, true);
+}
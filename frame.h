@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Offscreen 1-bpp frame
+// ----------------------------------------------------------------------------
+//
+// The GUI clears the canvas before every draw callback, so anything drawn
+// straight to the canvas has to be redrawn from scratch each frame.
+// Instead we keep our own frame that persists between draws: only the
+// regions that actually changed get rewritten, and draw_cb blits the whole
+// frame to the canvas with a single canvas_draw_xbm call.
+//
+// Layout is XBM: row-major, FRAME_STRIDE bytes per row, LSB is the leftmost pixel.
+// The Flipper's 128x64 unless built for another screen (layout.h).
+//
+#ifndef FRAME_W
+#define FRAME_W      128
+#define FRAME_H      64
+#endif
+#define FRAME_STRIDE (FRAME_W / 8)
+
+typedef struct {
+    union {
+        uint8_t px[FRAME_STRIDE * FRAME_H];
+        uint32_t words[FRAME_STRIDE * FRAME_H / 4]; // same pixels, for whole-frame passes
+    };
+    uint32_t px_written; // running count of pixels set or cleared (perf counter)
+} Frame;
+
+// Bytes per row of an XBM-layout bitmap w pixels wide.
+#define BITMAP_STRIDE(w) (((w) + 7) / 8)
+
+// Clear the whole frame to white.
+void frame_clear(Frame* f);
+
+// Fill (on=true) or clear (on=false) a rectangle. Clipped to the frame.
+void frame_box(Frame* f, int x, int y, int w, int h, bool on);
+
+// 1px outline of a rectangle (like canvas_draw_frame).
+void frame_outline(Frame* f, int x, int y, int w, int h);
+
+// Copy a whole frame (e.g. a cached background) into f.
+void frame_copy(Frame* f, const Frame* src);
+
+// dst = src with every pixel flipped: one XOR pass, a word at a time. For
+// showing a finished frame inverted; src is left alone, so incremental
+// redraws carry on in it. Not counted in px_written.
+void frame_invert(Frame* dst, const Frame* src);
+
+// 1px line from (x0, y0) to (x1, y1), both ends included (Bresenham).
+void frame_line(Frame* f, int x0, int y0, int x1, int y1);
+
+// Copy a w x h XBM-layout bitmap into the frame at (x, y). Opaque: clear bits
+// in the bitmap clear the frame, so no separate erase is needed.
+void frame_blit(Frame* f, int x, int y, int w, int h, const uint8_t* bits);
+
+// frame_box on any XBM-layout bitmap (bw x bh pixels). Used to rasterize glyphs.
+void bitmap_box(uint8_t* px, int bw, int bh, int x, int y, int w, int h, bool on);
@@ -0,0 +1,193 @@
+#include "glyphs.h"
+#include "frame.h"
+
+#include <furi.h>
+
+// ----------------------------------------------------------------------------
+// Segment map
+// ----------------------------------------------------------------------------
+//
+// segmap encodes which segments are on for digits 0..9.
+//
+// bit positions:
+// 0=a (top)
+// 1=b (upper-right)
+// 2=c (lower-right)
+// 3=d (bottom)
+// 4=e (lower-left)
+// 5=f (upper-left)
+// 6=g (middle)
+//
+static const uint8_t segmap[10] = {
+    /*0*/ 0b0111111,
+    /*1*/ 0b0000110,
+    /*2*/ 0b1011011,
+    /*3*/ 0b1001111,
+    /*4*/ 0b1100110,
+    /*5*/ 0b1101101,
+    /*6*/ 0b1111101,
+    /*7*/ 0b0000111,
+    /*8*/ 0b1111111,
+    /*9*/ 0b1101111,
+};
+
+static void segdigit(uint8_t* px, int w, int h, int t, int d) {
+    uint8_t m = segmap[d];
+    int ym = h / 2;
+    int half = h / 2;
+
+    // Horizontal segments. Full width so overlaps look solid (especially digit 8).
+    if(m & (1 << 0)) bitmap_box(px, w, h, 0, 0, w, t, true);              // a
+    if(m & (1 << 6)) bitmap_box(px, w, h, 0, ym - (t / 2), w, t, true);   // g
+    if(m & (1 << 3)) bitmap_box(px, w, h, 0, h - t, w, t, true);          // d
+
+    // Vertical segments. Each spans half height so they meet the middle bar cleanly.
+    if(m & (1 << 5)) bitmap_box(px, w, h, 0, 0, t, half, true);               // f
+    if(m & (1 << 1)) bitmap_box(px, w, h, w - t, 0, t, half, true);           // b
+    if(m & (1 << 4)) bitmap_box(px, w, h, 0, h - half, t, half, true);        // e
+    if(m & (1 << 2)) bitmap_box(px, w, h, w - t, h - half, t, half, true);    // c
+}
+
+void digitset_init(DigitSet* set, int w, int h, int t) {
+    set->w = (uint8_t)w;
+    set->h = (uint8_t)h;
+    set->t = (uint8_t)t;
+    set->size = (uint16_t)(BITMAP_STRIDE(w) * h);
+    set->bits = malloc(set->size * 10);
+    memset(set->bits, 0, set->size * 10);
+
+    for(int d = 0; d < 10; d++) {
+        segdigit(&set->bits[d * set->size], w, h, t, d);
+    }
+}
+
+void digitset_free(DigitSet* set) {
+    free(set->bits);
+    set->bits = NULL;
+}
+
+const uint8_t* digitset_glyph(const DigitSet* set, int d) {
+    furi_assert(d >= 0 && d <= 9);
+    return &set->bits[d * set->size];
+}
+
+// ----------------------------------------------------------------------------
+// Glyph cache
+// ----------------------------------------------------------------------------
+//
+// A handful of slots, searched linearly. bits == NULL marks a free slot.
+//
+typedef struct {
+    DigitSet set;
+    uint8_t refs;       // digitset_get calls not yet put back
+    uint32_t used;      // last get, in cache.clock steps (picks the eviction)
+} CacheSlot;
+
+static struct {
+    CacheSlot slot[GLYPH_CACHE_SETS];
+    uint32_t clock;
+    uint32_t hits;
+    uint32_t misses;
+} cache;
+
+static uint32_t set_bytes(const DigitSet* set) {
+    return (uint32_t)set->size * 10;
+}
+
+const DigitSet* digitset_get(int w, int h, int t) {
+    CacheSlot* free_slot = NULL;
+    CacheSlot* lru = NULL;   // least recently used released set
+
+    cache.clock++;
+    for(int i = 0; i < GLYPH_CACHE_SETS; i++) {
+        CacheSlot* c = &cache.slot[i];
+        if(!c->set.bits) {
+            if(!free_slot) free_slot = c;
+            continue;
+        }
+        if(c->set.w == w && c->set.h == h && c->set.t == t) {
+            cache.hits++;
+            c->refs++;
+            c->used = cache.clock;
+            return &c->set;
+        }
+        if(!c->refs && (!lru || c->used < lru->used)) lru = c;
+    }
+
+    CacheSlot* victim = free_slot ? free_slot : lru;
+    // Every slot in use means more geometries live at once than the cache is
+    // sized for: raise GLYPH_CACHE_SETS.
+    furi_check(victim);
+    if(victim->set.bits) digitset_free(&victim->set);
+
+    cache.misses++;
+    digitset_init(&victim->set, w, h, t);
+    victim->refs = 1;
+    victim->used = cache.clock;
+    return &victim->set;
+}
+
+void digitset_put(const DigitSet* set) {
+    CacheSlot* c = (CacheSlot*)set;   // set is the slot's first member
+    furi_assert(c >= cache.slot && c < cache.slot + GLYPH_CACHE_SETS);
+    furi_assert(c->refs);
+    c->refs--;
+}
+
+void glyph_cache_stats(GlyphCacheStats* stats) {
+    stats->hits = cache.hits;
+    stats->misses = cache.misses;
+    stats->sets = 0;
+    stats->bytes = 0;
+    for(int i = 0; i < GLYPH_CACHE_SETS; i++) {
+        if(!cache.slot[i].set.bits) continue;
+        stats->sets++;
+        stats->bytes += set_bytes(&cache.slot[i].set);
+    }
+}
+
+const DigitSet* glyph_cache_set(int i, uint32_t* bytes) {
+    for(int s = 0; s < GLYPH_CACHE_SETS; s++) {
+        const DigitSet* set = &cache.slot[s].set;
+        if(!set->bits || i--) continue;
+        *bytes = set_bytes(set);
+        return set;
+    }
+    return NULL;
+}
+
+void glyph_cache_clear(void) {
+    for(int i = 0; i < GLYPH_CACHE_SETS; i++) {
+        CacheSlot* c = &cache.slot[i];
+        if(c->set.bits && !c->refs) digitset_free(&c->set);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Packed glyphs
+// ----------------------------------------------------------------------------
+
+// Clear runs are painted as well as set ones, so every pixel of the glyph is
+// written once.
+void glyph_blit_packed(Frame* f, int x0, int y0, int w, int h, const uint8_t* runs) {
+    int x = 0, y = 0;
+    bool on = false;
+    while(y < h) {
+        int n = *runs;
+        const bool more = (n == 255);
+        // A run may wrap onto the following rows.
+        while(n > 0 && y < h) {
+            const int span = MIN(n, w - x);
+            bitmap_box(f->px, FRAME_W, FRAME_H, x0 + x, y0 + y, span, 1, on);
+            x += span;
+            n -= span;
+            if(x == w) {
+                x = 0;
+                y++;
+            }
+        }
+        runs++;
+        if(!more) on = !on;
+    }
+    f->px_written += (uint32_t)(w * h);
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "frame.h"
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Cached 7-seg digit glyphs
+// ----------------------------------------------------------------------------
+//
+// segdigit-style digits rasterized once per geometry into packed 1-bpp
+// bitmaps (XBM layout, same as Frame). Redrawing a digit is then one
+// frame_blit instead of up to seven box fills.
+//
+typedef struct {
+    uint8_t w, h, t;   // geometry the set was rasterized for
+    uint16_t size;     // bytes per glyph
+    uint8_t* bits;     // glyphs for 0..9, size bytes each
+} DigitSet;
+
+// Allocate and rasterize glyphs 0..9 for a w x h digit with segment thickness t.
+void digitset_init(DigitSet* set, int w, int h, int t);
+
+void digitset_free(DigitSet* set);
+
+// Glyph for digit d (0..9).
+const uint8_t* digitset_glyph(const DigitSet* set, int d);
+
+// ----------------------------------------------------------------------------
+// Glyph cache
+// ----------------------------------------------------------------------------
+//
+// One DigitSet per (w, h, t), shared by everything that draws at that
+// size. digitset_get rasterizes on first use; digitset_put releases it but
+// keeps it cached, so pages that come and go (date, sun) pay once per run
+// instead of once per draw. A released set is only evicted when its slot is
+// needed for another geometry. Not locked: callers hold the app mutex.
+//
+#define GLYPH_CACHE_SETS 6
+
+const DigitSet* digitset_get(int w, int h, int t);
+void digitset_put(const DigitSet* set);
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;     // rasterizations, including after an eviction
+    uint8_t sets;        // sets cached now
+    uint32_t bytes;      // glyph RAM held by them
+} GlyphCacheStats;
+
+void glyph_cache_stats(GlyphCacheStats* stats);
+
+// The i-th cached set (0..stats.sets-1) and its glyph RAM in bytes.
+const DigitSet* glyph_cache_set(int i, uint32_t* bytes);
+
+// Free the released sets (app exit).
+void glyph_cache_clear(void);
+
+// ----------------------------------------------------------------------------
+// Packed glyphs
+// ----------------------------------------------------------------------------
+//
+// Glyph tables that are mostly long straight bars (the portrait digits) are
+// stored as pixel runs instead of bitmaps: raster order, row by row, w
+// pixels a row, runs alternating clear and set starting with clear. Each
+// byte is a run length; 255 means 255 pixels and the run goes on in the next
+// byte. tools/portraitgen.py writes them.
+//
+// They are decoded straight into the frame and never kept unpacked (see
+// "Portrait" in the README for why there is no cache).
+//
+
+// Draw one run stream as a w x h glyph at (x, y). Opaque, like frame_blit.
+void glyph_blit_packed(Frame* f, int x, int y, int w, int h, const uint8_t* runs);
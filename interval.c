@@ -0,0 +1,146 @@
+#include "interval.h"
+
+#define INTERVAL_MIN_S 60
+#define INTERVAL_MAX_S (99 * 60)
+
+static uint32_t phase_s(const Interval* iv, uint8_t phase) {
+    return (phase % 2) ? iv->rest_s : iv->work_s;
+}
+
+// Lay out every phase end from iv->start. Only on start, resume and restore.
+static void schedule(Interval* iv) {
+    uint32_t t = iv->start;
+    for(uint8_t i = 0; i < iv->phases; i++) {
+        t += phase_s(iv, i);
+        iv->end[i] = t;
+    }
+}
+
+// The phase `elapsed` seconds into the run: whole cycles, then work or rest.
+static uint8_t phase_at(const Interval* iv, uint32_t elapsed) {
+    const uint32_t cycle = (uint32_t)iv->work_s + iv->rest_s;
+    const uint32_t phase = 2 * (elapsed / cycle) + (elapsed % cycle >= iv->work_s ? 1 : 0);
+    return phase < iv->phases ? (uint8_t)phase : iv->phases;
+}
+
+static uint16_t clamp_s(int32_t s) {
+    if(s < INTERVAL_MIN_S) s = INTERVAL_MIN_S;
+    if(s > INTERVAL_MAX_S) s = INTERVAL_MAX_S;
+    return (uint16_t)s;
+}
+
+void interval_init(Interval* iv, uint16_t work_s, uint16_t rest_s, uint8_t cycles) {
+    iv->work_s = clamp_s(work_s);
+    iv->rest_s = clamp_s(rest_s);
+    iv->cycles = cycles;
+    iv->phases = 2 * cycles - 1;
+    interval_reset(iv);
+}
+
+void interval_reset(Interval* iv) {
+    iv->state = IntervalIdle;
+    iv->phase = 0;
+    iv->start = 0;
+    iv->elapsed = 0;
+}
+
+void interval_adjust(Interval* iv, int32_t work_delta_s, int32_t rest_delta_s, int delta) {
+    if(iv->state != IntervalIdle) return;
+
+    iv->work_s = clamp_s((int32_t)iv->work_s + work_delta_s);
+    iv->rest_s = clamp_s((int32_t)iv->rest_s + rest_delta_s);
+    const int n = INTERVAL_CYCLES_MAX;
+    iv->cycles = (uint8_t)(((iv->cycles - 1 + delta) % n + n) % n + 1);
+    iv->phases = 2 * iv->cycles - 1;
+}
+
+void interval_start(Interval* iv, uint32_t now) {
+    if(iv->state == IntervalIdle) {
+        iv->elapsed = 0;
+    } else if(iv->state != IntervalPaused) {
+        return;
+    }
+
+    iv->start = now - iv->elapsed;
+    schedule(iv);
+    iv->state = IntervalRunning;
+}
+
+void interval_pause(Interval* iv, uint32_t now) {
+    if(iv->state != IntervalRunning) return;
+
+    // Settle the phase first, so elapsed always falls inside it.
+    interval_poll(iv, now);
+    if(iv->state != IntervalRunning) return;
+    iv->elapsed = now - iv->start;
+    iv->state = IntervalPaused;
+}
+
+bool interval_poll(Interval* iv, uint32_t now) {
+    if(!interval_due(iv, now)) return false;
+
+    // Normally one step; more only if wakeups were missed.
+    while(iv->phase < iv->phases && now >= iv->end[iv->phase]) iv->phase++;
+    if(iv->phase == iv->phases) iv->state = IntervalDone;
+    return true;
+}
+
+uint32_t interval_left(const Interval* iv, uint32_t now) {
+    switch(iv->state) {
+    case IntervalRunning:
+        return iv->end[iv->phase] > now ? iv->end[iv->phase] - now : 0;
+    case IntervalPaused:
+        return iv->end[iv->phase] - iv->start - iv->elapsed;
+    case IntervalDone:
+        return 0;
+    default:
+        return iv->work_s;
+    }
+}
+
+void interval_save(const Interval* iv, IntervalRecord* rec) {
+    *rec = (IntervalRecord){
+        .work_s = iv->work_s,
+        .rest_s = iv->rest_s,
+        .cycles = iv->cycles,
+        .state = iv->state,
+        .at = iv->state == IntervalPaused ? iv->elapsed : iv->start,
+    };
+}
+
+bool interval_restore(Interval* iv, const IntervalRecord* rec, uint32_t now) {
+    if(rec->cycles < 1 || rec->cycles > INTERVAL_CYCLES_MAX || rec->state > IntervalDone ||
+       rec->work_s < INTERVAL_MIN_S || rec->work_s > INTERVAL_MAX_S ||
+       rec->rest_s < INTERVAL_MIN_S || rec->rest_s > INTERVAL_MAX_S) {
+        return false;
+    }
+
+    interval_init(iv, rec->work_s, rec->rest_s, rec->cycles);
+    switch(rec->state) {
+    case IntervalRunning:
+        // A clock set back before the start counts as just started.
+        iv->start = rec->at <= now ? rec->at : now;
+        iv->phase = phase_at(iv, now - iv->start);
+        schedule(iv);
+        iv->state = iv->phase < iv->phases ? IntervalRunning : IntervalDone;
+        break;
+    case IntervalPaused:
+        iv->elapsed = rec->at;
+        iv->phase = phase_at(iv, iv->elapsed);
+        if(iv->phase == iv->phases) {
+            iv->state = IntervalDone;
+            break;
+        }
+        iv->start = now - iv->elapsed;
+        schedule(iv);
+        iv->state = IntervalPaused;
+        break;
+    case IntervalDone:
+        iv->phase = iv->phases;
+        iv->state = IntervalDone;
+        break;
+    default:
+        break;
+    }
+    return true;
+}
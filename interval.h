@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Interval timer
+// ----------------------------------------------------------------------------
+//
+// Work/rest cycles (Pomodoro): work, rest, work, ... work; the last work
+// phase has no rest after it. Starting lays the whole run out as absolute end
+// times, one per phase, so the per-tick check is a single compare against the
+// current phase's end (interval_due), like the alarms.
+//
+// Times are RTC timestamps (seconds), not ticks, so a run survives the app
+// being closed: IntervalRecord is all that is saved, and interval_restore
+// rebuilds the schedule and works out the current phase arithmetically,
+// without stepping through the time that passed.
+//
+#define INTERVAL_CYCLES_MAX 16
+#define INTERVAL_PHASES_MAX (2 * INTERVAL_CYCLES_MAX - 1)
+#define INTERVAL_NONE       UINT32_MAX   // no deadline
+
+typedef enum {
+    IntervalIdle,      // showing the first work phase, editable
+    IntervalRunning,
+    IntervalPaused,
+    IntervalDone,
+} IntervalState;
+
+typedef struct {
+    uint8_t state;     // IntervalState
+    uint8_t cycles;    // work phases, 1..INTERVAL_CYCLES_MAX
+    uint8_t phase;     // even = work, odd = rest; == phases once done
+    uint8_t phases;    // 2 * cycles - 1
+    uint16_t work_s;   // seconds per work phase
+    uint16_t rest_s;   // seconds per rest phase
+    uint32_t start;    // when the run began, moved on by pauses (Running)
+    uint32_t elapsed;  // seconds into the run (Paused)
+    uint32_t end[INTERVAL_PHASES_MAX]; // phase end times (Running, Paused)
+} Interval;
+
+// What is saved (12 bytes): the settings, the state and one timestamp.
+typedef struct {
+    uint16_t work_s;
+    uint16_t rest_s;
+    uint8_t cycles;
+    uint8_t state;
+    uint16_t reserved;
+    uint32_t at;       // Interval.start (Running) or Interval.elapsed (Paused)
+} IntervalRecord;
+
+void interval_init(Interval* iv, uint16_t work_s, uint16_t rest_s, uint8_t cycles);
+
+// Back to Idle, settings kept.
+void interval_reset(Interval* iv);
+
+// Change the work or rest time by delta_s (clamped to 1 min .. 99 min), or
+// the cycle count by delta (wrapping within 1..INTERVAL_CYCLES_MAX). Idle only.
+void interval_adjust(Interval* iv, int32_t work_delta_s, int32_t rest_delta_s, int delta);
+
+// Start at RTC time `now` (Idle), or resume (Paused).
+void interval_start(Interval* iv, uint32_t now);
+
+void interval_pause(Interval* iv, uint32_t now);
+
+// Step past every phase that has ended by `now`; Running -> Done after the
+// last. True if the phase changed.
+bool interval_poll(Interval* iv, uint32_t now);
+
+// Seconds left in the current phase as of `now`.
+uint32_t interval_left(const Interval* iv, uint32_t now);
+
+// End of the current phase, or INTERVAL_NONE unless running.
+static inline uint32_t interval_deadline(const Interval* iv) {
+    return iv->state == IntervalRunning ? iv->end[iv->phase] : INTERVAL_NONE;
+}
+
+// The per-tick check: a single compare.
+static inline bool interval_due(const Interval* iv, uint32_t now) {
+    return now >= interval_deadline(iv);
+}
+
+static inline bool interval_resting(const Interval* iv) {
+    return iv->phase % 2 == 1;
+}
+
+void interval_save(const Interval* iv, IntervalRecord* rec);
+
+// Rebuild from a record as of `now`. False (and left Idle with defaults
+// untouched) if the record is invalid.
+bool interval_restore(Interval* iv, const IntervalRecord* rec, uint32_t now);
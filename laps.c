@@ -0,0 +1,84 @@
+#include "laps.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LAP_MASK (LAPS_MAX - 1)
+
+_Static_assert((LAPS_MAX & LAP_MASK) == 0, "LAPS_MAX must be a power of two");
+
+void laps_reset(Laps* laps) {
+    // The ring itself needs no clearing: only the held laps are ever read.
+    laps->count = 0;
+    laps->last = 0;
+    laps->best = 0;
+    laps->best_lap = 0;
+    laps->total = 0;
+    laps->saved = true;
+}
+
+void laps_add(Laps* laps, uint32_t ticks) {
+    laps->ticks[laps->count & LAP_MASK] = ticks;
+    laps->count++;
+    laps->last = ticks;
+    laps->total += ticks;
+    if(laps->count == 1 || ticks < laps->best) {
+        laps->best = ticks;
+        laps->best_lap = laps->count;
+    }
+    laps->saved = false;
+}
+
+uint32_t laps_avg(const Laps* laps) {
+    return laps->count ? (uint32_t)(laps->total / laps->count) : 0;
+}
+
+uint32_t laps_held(const Laps* laps) {
+    return laps->count < LAPS_MAX ? laps->count : LAPS_MAX;
+}
+
+static unsigned long to_ms(uint64_t ticks, uint32_t tick_hz) {
+    return (unsigned long)(ticks * 1000 / tick_hz);
+}
+
+// Format everything into out (NULL: just measure). Returns the length.
+static size_t format(const Laps* laps, uint32_t tick_hz, char* out, size_t size) {
+    const uint32_t held = laps_held(laps);
+    const uint32_t first = laps->count - held + 1;
+    size_t len = 0;
+
+    // Elapsed before the first held lap: everything minus the held laps.
+    uint64_t split = laps->total;
+    for(uint32_t n = first; n <= laps->count; n++) split -= laps->ticks[(n - 1) & LAP_MASK];
+
+#define PUT(...) len += snprintf(out ? out + len : NULL, out ? size - len : 0, __VA_ARGS__)
+    PUT("lap,ms,split_ms\n");
+    for(uint32_t n = first; n <= laps->count; n++) {
+        const uint32_t t = laps->ticks[(n - 1) & LAP_MASK];
+        split += t;
+        PUT("%lu,%lu,%lu\n", (unsigned long)n, to_ms(t, tick_hz), to_ms(split, tick_hz));
+    }
+    PUT("# best lap %lu %lu ms, average %lu ms, %lu laps\n",
+        (unsigned long)laps->best_lap,
+        to_ms(laps->best, tick_hz),
+        to_ms(laps_avg(laps), tick_hz),
+        (unsigned long)laps->count);
+#undef PUT
+    return len;
+}
+
+char* laps_csv_text(const Laps* laps, uint32_t tick_hz, size_t* len) {
+    *len = format(laps, tick_hz, NULL, 0);
+    char* buf = malloc(*len + 1);
+    format(laps, tick_hz, buf, *len + 1);
+    return buf;
+}
+
+bool laps_csv(const Laps* laps, uint32_t tick_hz, LapsWrite write, void* ctx) {
+    size_t len;
+    char* buf = laps_csv_text(laps, tick_hz, &len);
+    const bool ok = write(ctx, buf, len) == len;
+    free(buf);
+    return ok;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Lap history
+// ----------------------------------------------------------------------------
+//
+// The stopwatch's laps in a fixed ring: the newest LAPS_MAX are kept, older
+// ones drop out. Best, average and last cover every lap since reset and are
+// updated as each lap comes in, so a lap costs the same whether it is the
+// first or the ten-thousandth. Nothing here touches storage: laps_csv formats
+// the held laps and hands them to the caller's write function in one call.
+//
+#define LAPS_MAX 512   // power of two
+
+typedef struct {
+    uint32_t ticks[LAPS_MAX]; // lap durations, ring; lap n is at (n - 1) % LAPS_MAX
+    uint32_t count;           // laps since reset
+    uint32_t last;            // most recent lap, ticks
+    uint32_t best;            // shortest lap, ticks
+    uint32_t best_lap;        // its number, 1-based
+    uint64_t total;           // all laps summed (for the average)
+    bool saved;               // exported since the last lap
+} Laps;
+
+void laps_reset(Laps* laps);
+void laps_add(Laps* laps, uint32_t ticks);
+
+// Mean lap in ticks, 0 before the first.
+uint32_t laps_avg(const Laps* laps);
+
+// Laps in the ring (the newest min(count, LAPS_MAX)).
+uint32_t laps_held(const Laps* laps);
+
+// Writes size bytes, returns how many were written.
+typedef size_t (*LapsWrite)(void* ctx, const void* data, size_t size);
+
+// The held laps as CSV, oldest first: "lap,ms,split_ms" (split = elapsed at
+// the end of the lap), then a summary line. Formatted into one buffer and
+// written with a single write call. Returns false if the write fell short.
+bool laps_csv(const Laps* laps, uint32_t tick_hz, LapsWrite write, void* ctx);
+
+// The same CSV as a malloc'd string (caller frees) of *len bytes, for a caller
+// that snapshots the laps under a lock and writes them after letting go.
+char* laps_csv_text(const Laps* laps, uint32_t tick_hz, size_t* len);
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "frame.h"
+
+// ----------------------------------------------------------------------------
+// Landscape layout
+// ----------------------------------------------------------------------------
+//
+// Every landscape position and size, worked out by the preprocessor from
+// FRAME_W x FRAME_H (frame.h; pass -DFRAME_W=.. -DFRAME_H=.. for another
+// screen). The design is drawn for 128x64 and scaled: LAYOUT_X along the
+// width, LAYOUT_Y along the height, LAYOUT_S for things that must stay
+// square (strokes, squares, radii) by the smaller of the two. Text is canvas
+// font and doesn't scale, so labels are anchored to the edges instead.
+// Nothing is computed at runtime. The asserts at the bottom check that the
+// result fits any screen, and pin the values for 128x64 and 192x96.
+//
+#define LAYOUT_X(v) ((v) * FRAME_W / 128)
+#define LAYOUT_Y(v) ((v) * FRAME_H / 64)
+#define LAYOUT_S(v) ((v) * LAYOUT_S_NUM / (128 * 64))
+#define LAYOUT_S_NUM (FRAME_W * 64 < FRAME_H * 128 ? FRAME_W * 64 : FRAME_H * 128)
+
+// Gutter on the right: seconds grid or small digits, then up to three labels
+// (canvas text, 8 px rows, baselines at the bottom of the screen).
+#define GUTTER_W    LAYOUT_X(12)
+#define RIGHT_EDGE  (FRAME_W - 2 - GUTTER_W)
+#define LABEL_X     (FRAME_W - 13)
+#define LABEL_Y(i)  (FRAME_H - 16 + 8 * (i))
+#define LABEL_TOP   (LABEL_Y(0) - 8)
+
+// Portrait glyphs and positions are generated for the Flipper's screen only.
+#define LAYOUT_PORTRAIT (FRAME_W == 128 && FRAME_H == 64)
+
+// Seven-segment face (segface.c): HH:MM, full height.
+#define SEG_DIGIT_W   LAYOUT_X(23)
+#define SEG_DIGIT_H   FRAME_H
+#define SEG_DIGIT_T   LAYOUT_S(7)
+#define SEG_GAP       LAYOUT_X(3)
+#define SEG_COLON_W   LAYOUT_S(6)
+#define SEG_COLON_GAP LAYOUT_X(2)
+#define SEG_COLON_Y0  LAYOUT_Y(16)
+#define SEG_COLON_Y1  LAYOUT_Y(40)
+#define SEG_X_H0      LAYOUT_X(2)
+#define SEG_X_H1      (SEG_X_H0 + SEG_DIGIT_W + SEG_GAP)
+#define SEG_X_CO      (SEG_X_H1 + SEG_DIGIT_W + SEG_COLON_GAP)
+#define SEG_X_M0      (SEG_X_CO + SEG_COLON_W + SEG_COLON_GAP)
+#define SEG_X_M1      (SEG_X_M0 + SEG_DIGIT_W + SEG_GAP)
+
+// Gutter digits, tens on top, and the 60-step seconds grid (6 x 10 ticks).
+#define SEG_SMALL_W   LAYOUT_X(11)
+#define SEG_SMALL_H   LAYOUT_Y(19)
+#define SEG_SMALL_T   LAYOUT_S(2)
+#define SEG_SMALL_GAP LAYOUT_Y(2)
+#define SEG_GUTTER_X  (RIGHT_EDGE + (GUTTER_W - SEG_SMALL_W + 1) / 2)
+#define SEG_GRID_COLS 6
+#define SEG_GRID_ROWS 10
+#define SEG_TICK_W    LAYOUT_S(1)
+#define SEG_TICK_H    LAYOUT_S(3)
+#define SEG_TICK_GAP  LAYOUT_S(1)
+#define SEG_ROW_H     (SEG_TICK_H + SEG_TICK_GAP)
+#define SEG_GRID_W    (SEG_GRID_COLS * (SEG_TICK_W + SEG_TICK_GAP) - SEG_TICK_GAP)
+#define SEG_GRID_H    (SEG_GRID_ROWS * SEG_ROW_H)
+
+// Analog dial (analog.c), centered left of the gutter. Hands and marks are
+// the 128x64 lengths scaled with the radius.
+#define DIAL_CX       LAYOUT_X(58)
+#define DIAL_CY       LAYOUT_Y(31)
+#define DIAL_R        LAYOUT_S(31)
+#define DIAL_LEN(v)   ((v) * DIAL_R / 31)
+
+// Binary face (binary.c): square cells; columns in pairs, rows bottom up.
+#define BIN_CELL      LAYOUT_S(13)
+#define BIN_COL_X(i)  LAYOUT_X((i) * 16 + (i) / 2 * 5 + 6)
+#define BIN_ROW_Y(b)  LAYOUT_Y(48 - 16 * (b))
+
+// Date page (datepage.c): DD.MM over YYYY, centered left of the gutter.
+#define DATE_DIGIT_W  LAYOUT_X(18)
+#define DATE_DIGIT_H  LAYOUT_Y(29)
+#define DATE_DIGIT_T  LAYOUT_S(4)
+#define DATE_GAP      LAYOUT_X(3)
+#define DATE_DOT      LAYOUT_S(4)
+#define DATE_AREA_W   RIGHT_EDGE
+#define DATE_TOP_W    (4 * DATE_DIGIT_W + 4 * DATE_GAP + DATE_DOT)
+
+// Sun page (sunpage.c): moon on the left, rise and set times on the right.
+#define SUN_MOON_CX   LAYOUT_X(23)
+#define SUN_MOON_CY   LAYOUT_Y(32)
+#define SUN_MOON_R    LAYOUT_S(20)
+#define SUN_DIGIT_W   SEG_SMALL_W   // same set as the gutter digits
+#define SUN_DIGIT_H   SEG_SMALL_H
+#define SUN_DIGIT_T   SEG_SMALL_T
+#define SUN_ROW_RISE  LAYOUT_Y(6)
+#define SUN_ROW_SET   LAYOUT_Y(39)
+#define SUN_ARROW_X   LAYOUT_X(47)
+#define SUN_ARROW_DY  LAYOUT_Y(7)
+#define SUN_TIME_X    LAYOUT_X(57)
+#define SUN_TIME_DX(i) LAYOUT_X((i) * 13 + (i) / 2 * 4)   // digit i of HH:MM
+#define SUN_COLON_DX  LAYOUT_X(26)
+#define SUN_COLON_W   LAYOUT_S(2)
+#define SUN_COLON_DY0 LAYOUT_Y(5)
+#define SUN_COLON_DY1 LAYOUT_Y(12)
+
+// ----------------------------------------------------------------------------
+// Checks
+// ----------------------------------------------------------------------------
+
+_Static_assert(FRAME_W % 8 == 0 && (FRAME_STRIDE * FRAME_H) % 4 == 0, "frame rows must pack");
+_Static_assert(FRAME_W <= 255 && FRAME_H <= 255, "FaceRect and DigitSet hold uint8_t sizes");
+_Static_assert(FRAME_W >= 128 && FRAME_H >= 64, "the layout is designed for 128x64 and up");
+
+_Static_assert(SEG_X_M1 + SEG_DIGIT_W <= RIGHT_EDGE, "digits run into the gutter");
+_Static_assert(SEG_COLON_Y1 + SEG_COLON_W <= FRAME_H, "colon runs off the screen");
+_Static_assert(SEG_SMALL_W <= GUTTER_W && SEG_GRID_W <= SEG_SMALL_W, "gutter too narrow");
+_Static_assert(2 * SEG_SMALL_H + SEG_SMALL_GAP <= LABEL_TOP, "gutter digits run into labels");
+_Static_assert(SEG_GRID_H <= LABEL_TOP, "seconds grid runs into labels");
+_Static_assert(DIAL_CX + DIAL_R < RIGHT_EDGE && DIAL_CY + DIAL_R < FRAME_H, "dial off screen");
+_Static_assert(BIN_COL_X(5) + BIN_CELL <= RIGHT_EDGE, "binary columns run into the gutter");
+_Static_assert(BIN_ROW_Y(0) + BIN_CELL <= FRAME_H, "binary rows run off the screen");
+_Static_assert(DATE_TOP_W <= DATE_AREA_W && 2 * DATE_DIGIT_H <= FRAME_H, "date page too big");
+_Static_assert(SUN_MOON_CX + SUN_MOON_R < SUN_ARROW_X, "moon runs into the arrows");
+_Static_assert(SUN_TIME_X + SUN_TIME_DX(3) + SUN_DIGIT_W <= RIGHT_EDGE, "sun times too wide");
+_Static_assert(SUN_ROW_SET + SUN_DIGIT_H <= FRAME_H, "sun times run off the screen");
+
+// Golden values: the Flipper (the layout the app has always drawn) and a
+// 1.5x host surface.
+#if FRAME_W == 128 && FRAME_H == 64
+_Static_assert(RIGHT_EDGE == 114 && LABEL_X == 115 && LABEL_Y(0) == 48, "128x64 gutter");
+_Static_assert(SEG_DIGIT_W == 23 && SEG_DIGIT_T == 7 && SEG_X_M1 == 87, "128x64 digits");
+_Static_assert(SEG_X_CO == 53 && SEG_GUTTER_X == 115 && SEG_GRID_H == 40, "128x64 gutter");
+_Static_assert(DIAL_CX == 58 && DIAL_CY == 31 && DIAL_R == 31 && DIAL_LEN(16) == 16, "128x64 dial");
+_Static_assert(BIN_COL_X(2) == 43 && BIN_COL_X(5) == 96 && BIN_CELL == 13, "128x64 binary");
+_Static_assert(DATE_DIGIT_W == 18 && DATE_DIGIT_H == 29 && DATE_TOP_W == 88, "128x64 date");
+_Static_assert(SUN_TIME_DX(2) == 30 && SUN_TIME_DX(3) == 43 && SUN_ROW_SET == 39, "128x64 sun");
+#elif FRAME_W == 192 && FRAME_H == 96
+_Static_assert(RIGHT_EDGE == 172 && LABEL_X == 179 && LABEL_Y(0) == 80, "192x96 gutter");
+_Static_assert(SEG_DIGIT_W == 34 && SEG_DIGIT_T == 10 && SEG_X_M1 == 128, "192x96 digits");
+_Static_assert(SEG_X_CO == 78 && SEG_GUTTER_X == 173 && SEG_GRID_H == 50, "192x96 gutter");
+_Static_assert(DIAL_CX == 87 && DIAL_CY == 46 && DIAL_R == 46 && DIAL_LEN(16) == 23, "192x96 dial");
+_Static_assert(BIN_COL_X(2) == 64 && BIN_COL_X(5) == 144 && BIN_CELL == 19, "192x96 binary");
+_Static_assert(DATE_DIGIT_W == 27 && DATE_DIGIT_H == 43 && DATE_TOP_W == 130, "192x96 date");
+_Static_assert(SUN_TIME_DX(2) == 45 && SUN_TIME_DX(3) == 64 && SUN_ROW_SET == 58, "192x96 sun");
+#endif
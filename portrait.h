@@ -0,0 +1,62 @@
+#pragma once
+
+#include "glyphs.h"
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Portrait layout
+// ----------------------------------------------------------------------------
+//
+// HH above MM on a 64x128 logical screen (Flipper turned a quarter clockwise,
+// screen's left edge up), seconds and labels in a strip underneath. Glyphs
+// and positions come pre-rotated from tools/portraitgen.py (portraitdata.c):
+// every size and position below is in physical 128x64 frame coordinates, so
+// portrait is drawn with the same frame_blit / frame_box calls as landscape
+// and nothing is rotated at runtime.
+//
+
+// A glyph table, rotated: w x h is the physical size. Stored as bitmaps, or
+// packed into pixel runs (glyphs.h) when that is smaller.
+typedef struct {
+    uint8_t w, h;
+    uint8_t t;               // digits: segment thickness (as glyphs.c takes it), 0 = font
+    uint16_t size;           // bytes per glyph, unpacked
+    const uint8_t* bits;     // XBM layout, size bytes each; NULL when packed
+    const uint8_t* runs;     // packed: run streams...
+    const uint16_t* offset;  // ...and where each glyph's starts
+} PortraitSet;
+
+typedef struct {
+    uint8_t x, y;
+} PortraitAt;
+
+typedef struct {
+    uint8_t x, y, w, h;
+} PortraitRect;
+
+typedef struct {
+    PortraitAt digit[4];      // big digits, H0 H1 M0 M1
+    PortraitAt small[2];      // gutter digits, tens first
+    PortraitRect colon[2];
+    PortraitRect grid;        // area of the seconds ticks
+    uint8_t tick_w, tick_h;
+    PortraitAt tick[60];      // seconds ticks in fill order
+    PortraitAt label[3][2];   // label slots, two characters each
+} PortraitLayout;
+
+extern const PortraitSet portrait_big;   // digits 0..9
+extern const PortraitSet portrait_small; // digits 0..9
+extern const PortraitSet portrait_font;  // portrait_chars, in order
+extern const char portrait_chars[];
+extern const PortraitLayout portrait_layout;
+
+// Draw glyph i of set at (x, y), opaque like frame_blit. A packed glyph is
+// decoded straight into the frame.
+static inline void portrait_blit(Frame* f, const PortraitSet* set, int i, int x, int y) {
+    if(set->bits) {
+        frame_blit(f, x, y, set->w, set->h, &set->bits[i * set->size]);
+    } else {
+        glyph_blit_packed(f, x, y, set->w, set->h, &set->runs[set->offset[i]]);
+    }
+}
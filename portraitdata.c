@@ -0,0 +1,104 @@
+// Generated by tools/portraitgen.py. Do not edit; change the script and regenerate.
+
+#include "portrait.h"
+
+#include <stddef.h>
+
+static const uint8_t portrait_big_runs[] = {
+    0x00, 0xff, 0x3f, 0x28, 0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28,
+    0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28, 0x0c, 0x28,
+    0xff, 0x3f, 0x00, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0x48, 0x00, 0x1d, 0x11, 0x23, 0x11, 0x23,
+    0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c,
+    0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c,
+    0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c,
+    0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c,
+    0x11, 0x06, 0x11, 0x0c, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x1d,
+    0x00, 0xff, 0x3f, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11,
+    0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11,
+    0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11,
+    0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11,
+    0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11,
+    0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x06, 0x00, 0xff, 0x39, 0x17, 0x06, 0x2e, 0x06, 0x2e, 0x06,
+    0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06,
+    0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x17, 0x1d, 0x17, 0x1d, 0x17, 0x1d, 0x17, 0x1d,
+    0x17, 0x1d, 0x17, 0x1d, 0x17, 0x00, 0x06, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11,
+    0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11,
+    0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11,
+    0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x06, 0x00, 0x06, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0xff, 0x3f, 0x00, 0xff, 0x3f, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e,
+    0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e,
+    0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e, 0x06, 0x2e,
+    0x06, 0x2e, 0x00, 0xff, 0x3f, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0xff, 0x3f, 0x00, 0xff, 0x3f, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11, 0x0c, 0x11, 0x06, 0x11,
+    0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x06,
+};
+
+static const uint16_t portrait_big_offset[] = {0, 34, 42, 128, 215, 261, 347, 422, 466, 530};
+
+const PortraitSet portrait_big = {52, 27, 6, 189, NULL, portrait_big_runs, portrait_big_offset};
+
+static const uint8_t portrait_small_bits[] = {
+    0xbf, 0x1f, 0xbf, 0x1f, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0xbf, 0x1f,
+    0xbf, 0x1f, 0xbf, 0x1f, 0xbf, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0x18, 0x7f, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18,
+    0x63, 0x18, 0xe3, 0x1f, 0xe3, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18,
+    0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0xff, 0x1f, 0xff, 0x1f, 0x60, 0x00, 0x60, 0x00,
+    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0xe3, 0x1f, 0xe3, 0x1f, 0x63, 0x18,
+    0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x7f, 0x18, 0x7f, 0x18, 0xe3, 0x1f, 0xe3, 0x1f,
+    0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0xff, 0x1f, 0xff, 0x1f, 0xbf, 0x1f,
+    0xbf, 0x1f, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0xff, 0x1f, 0xff, 0x1f, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0xff, 0x1f,
+    0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18,
+    0x7f, 0x18, 0x7f, 0x18,
+};
+
+const PortraitSet portrait_small = {13, 9, 2, 18, portrait_small_bits, NULL, NULL};
+
+static const uint8_t portrait_font_bits[] = {
+    0x00, 0x17, 0x00, 0x1f, 0x11, 0x1f, 0x10, 0x1f, 0x12, 0x12, 0x15, 0x19, 0x0a, 0x15, 0x11, 0x1f,
+    0x04, 0x07, 0x09, 0x15, 0x17, 0x1d, 0x15, 0x1e, 0x03, 0x1d, 0x01, 0x1f, 0x15, 0x1f, 0x0f, 0x15,
+    0x17, 0x1e, 0x05, 0x1e, 0x0a, 0x15, 0x1f, 0x11, 0x11, 0x0e, 0x0e, 0x11, 0x1f, 0x11, 0x15, 0x1f,
+    0x01, 0x05, 0x1f, 0x1d, 0x11, 0x0e, 0x1f, 0x04, 0x1f, 0x11, 0x1f, 0x11, 0x0f, 0x10, 0x08, 0x1b,
+    0x04, 0x1f, 0x10, 0x10, 0x1f, 0x1f, 0x06, 0x1f, 0x1e, 0x01, 0x1f, 0x0e, 0x11, 0x0e, 0x02, 0x05,
+    0x1f, 0x16, 0x19, 0x0e, 0x1a, 0x05, 0x1f, 0x09, 0x15, 0x12, 0x01, 0x1f, 0x01, 0x1f, 0x10, 0x1f,
+    0x0f, 0x10, 0x0f, 0x1f, 0x0c, 0x1f, 0x1b, 0x04, 0x1b, 0x03, 0x1c, 0x03, 0x13, 0x15, 0x19, 0x00,
+    0x1f, 0x00,
+};
+
+const PortraitSet portrait_font = {5, 3, 0, 3, portrait_font_bits, NULL, NULL};
+
+const char portrait_chars[] = "!0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ|";
+
+const PortraitLayout portrait_layout = {
+    .digit = {{0, 34}, {0, 3}, {60, 34}, {60, 3}},
+    .small = {{114, 52}, {114, 41}},
+    .colon = {{54, 40, 4, 4}, {54, 20, 4, 4}},
+    .grid = {115, 22, 11, 39},
+    .tick_w = 3,
+    .tick_h = 1,
+    .tick = {
+        {115, 60}, {115, 58}, {115, 56}, {115, 54}, {115, 52}, {115, 50}, {115, 48}, {115, 46}, {115, 44}, {115, 42},
+        {115, 40}, {115, 38}, {115, 36}, {115, 34}, {115, 32}, {115, 30}, {115, 28}, {115, 26}, {115, 24}, {115, 22},
+        {119, 60}, {119, 58}, {119, 56}, {119, 54}, {119, 52}, {119, 50}, {119, 48}, {119, 46}, {119, 44}, {119, 42},
+        {119, 40}, {119, 38}, {119, 36}, {119, 34}, {119, 32}, {119, 30}, {119, 28}, {119, 26}, {119, 24}, {119, 22},
+        {123, 60}, {123, 58}, {123, 56}, {123, 54}, {123, 52}, {123, 50}, {123, 48}, {123, 46}, {123, 44}, {123, 42},
+        {123, 40}, {123, 38}, {123, 36}, {123, 34}, {123, 32}, {123, 30}, {123, 28}, {123, 26}, {123, 24}, {123, 22},
+    },
+    .label = {
+        {{115, 15}, {115, 11}},
+        {{122, 15}, {122, 11}},
+        {{122, 6}, {122, 2}},
+    },
+};
@@ -0,0 +1,164 @@
+#include "portraitface.h"
+#include "portrait.h"
+
+#include <furi.h>
+#include <stdio.h>
+
+#define LABEL_SLOTS 3
+
+typedef struct {
+    Readout r;                  // last Readout; render draws this one
+    bool fresh;                 // no Readout yet
+    int8_t ticks;               // seconds ticks in the frame
+    char label[LABEL_SLOTS][3]; // labels of r, cut to the two characters a slot holds
+} PortraitFace;
+
+static FaceRect glyph_rect(const PortraitSet* set, PortraitAt at) {
+    return (FaceRect){at.x, at.y, set->w, set->h};
+}
+
+static FaceRect label_rect(int slot) {
+    const PortraitAt* at = portrait_layout.label[slot];
+    const int x = MIN(at[0].x, at[1].x);
+    const int y = MIN(at[0].y, at[1].y);
+    const int w = MAX(at[0].x, at[1].x) + portrait_font.w - x;
+    const int h = MAX(at[0].y, at[1].y) + portrait_font.h - y;
+    return (FaceRect){(uint8_t)x, (uint8_t)y, (uint8_t)w, (uint8_t)h};
+}
+
+static FaceRect grid_rect(void) {
+    const PortraitRect* g = &portrait_layout.grid;
+    return (FaceRect){g->x, g->y, g->w, g->h};
+}
+
+static void* portrait_init(void) {
+    PortraitFace* p = malloc(sizeof(PortraitFace));
+    memset(p, 0, sizeof(PortraitFace));
+    p->fresh = true;
+    return p;
+}
+
+static void portrait_deinit(void* face) {
+    free(face);
+}
+
+static int portrait_on_tick(void* face, const Readout* r, FaceRect* damage, uint8_t* next_s) {
+    PortraitFace* p = face;
+    const PortraitLayout* l = &portrait_layout;
+    const Readout* old = &p->r;
+    FaceRect found[4 + 2 + LABEL_SLOTS];
+    int n = 0;
+
+    char label[LABEL_SLOTS][3];
+    memset(label, 0, sizeof(label));
+    for(int i = 0; i < LABEL_SLOTS; i++) {
+        snprintf(label[i], sizeof(label[i]), "%s", r->label[i] ? r->label[i] : "");
+    }
+
+    if(p->fresh || r->small != old->small) {
+        found[n++] = face_screen;
+    } else {
+        for(int i = 0; i < 4; i++) {
+            if(r->big[i] != old->big[i]) found[n++] = glyph_rect(&portrait_big, l->digit[i]);
+        }
+        if(r->small) {
+            for(int i = 0; i < 2; i++) {
+                if(r->small_digit[i] != old->small_digit[i]) {
+                    found[n++] = glyph_rect(&portrait_small, l->small[i]);
+                }
+            }
+        } else if(r->grid != old->grid) {
+            found[n++] = grid_rect();
+        }
+        for(int i = 0; i < LABEL_SLOTS; i++) {
+            if(strcmp(label[i], p->label[i])) found[n++] = label_rect(i);
+        }
+    }
+
+    // Everything at once (a digit roll plus labels) is cheaper as one redraw.
+    if(n > FACE_DAMAGE_MAX) {
+        found[0] = face_screen;
+        n = 1;
+    }
+    memcpy(damage, found, n * sizeof(FaceRect));
+
+    p->r = *r;
+    memcpy(p->label, label, sizeof(label));
+    p->fresh = false;
+    *next_s = readout_next_s(r);
+    return n;
+}
+
+// d is -1 (or any non-digit) for blank.
+static void draw_glyph(Frame* f, const PortraitSet* set, PortraitAt at, int d) {
+    if(d < 0 || d > 9) {
+        frame_box(f, at.x, at.y, set->w, set->h, false);
+    } else {
+        portrait_blit(f, set, d, at.x, at.y);
+    }
+}
+
+static void draw_label(Frame* f, int slot, const char* text) {
+    const PortraitSet* font = &portrait_font;
+    for(int i = 0; i < 2; i++) {
+        const PortraitAt at = portrait_layout.label[slot][i];
+        const char* c = text[i] ? strchr(portrait_chars, text[i]) : NULL;
+        if(c) {
+            portrait_blit(f, font, c - portrait_chars, at.x, at.y);
+        } else {
+            frame_box(f, at.x, at.y, font->w, font->h, false);
+        }
+    }
+}
+
+static void portrait_render(void* face, Frame* f, const FaceRect* region) {
+    PortraitFace* p = face;
+    const PortraitLayout* l = &portrait_layout;
+
+    if(region->w == FRAME_W && region->h == FRAME_H) {
+        frame_clear(f);
+        for(int i = 0; i < 2; i++) {
+            frame_box(f, l->colon[i].x, l->colon[i].y, l->colon[i].w, l->colon[i].h, true);
+        }
+        p->ticks = 0;
+    }
+
+    for(int i = 0; i < 4; i++) {
+        const FaceRect at = glyph_rect(&portrait_big, l->digit[i]);
+        if(face_overlaps(region, &at)) draw_glyph(f, &portrait_big, l->digit[i], p->r.big[i]);
+    }
+
+    const FaceRect grid = grid_rect();
+    if(p->r.small) {
+        for(int i = 0; i < 2; i++) {
+            const FaceRect at = glyph_rect(&portrait_small, l->small[i]);
+            if(face_overlaps(region, &at)) {
+                draw_glyph(f, &portrait_small, l->small[i], p->r.small_digit[i]);
+            }
+        }
+    } else if(face_overlaps(region, &grid)) {
+        // Seconds ticks: same fill order and rollover rule as the landscape grid.
+        const int count = p->r.grid;
+        int drawn = p->ticks;
+        if(drawn > count) {
+            frame_box(f, l->grid.x, l->grid.y, l->grid.w, l->grid.h, false);
+            drawn = 0;
+        }
+        for(int i = drawn; i < count && i < 60; i++) {
+            frame_box(f, l->tick[i].x, l->tick[i].y, l->tick_w, l->tick_h, true);
+        }
+        p->ticks = (int8_t)count;
+    }
+
+    for(int i = 0; i < LABEL_SLOTS; i++) {
+        const FaceRect at = label_rect(i);
+        if(face_overlaps(region, &at)) draw_label(f, i, p->label[i]);
+    }
+}
+
+const ClockFace portrait_face = {
+    .init = portrait_init,
+    .deinit = portrait_deinit,
+    .on_tick = portrait_on_tick,
+    .render = portrait_render,
+};
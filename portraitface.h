@@ -0,0 +1,15 @@
+#pragma once
+
+#include "face.h"
+
+// ----------------------------------------------------------------------------
+// Portrait face
+// ----------------------------------------------------------------------------
+//
+// The digital face laid out HH above MM (portrait.h), drawn from the
+// pre-rotated tables in portraitdata.c with the same blits and boxes as
+// landscape. Labels are glyphs in the frame too (canvas text can't turn), so
+// unlike the landscape faces it reports them as damage. 128x64 only
+// (LAYOUT_PORTRAIT).
+//
+extern const ClockFace portrait_face;
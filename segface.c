@@ -0,0 +1,152 @@
+#include "segface.h"
+#include "glyphs.h"
+#include "layout.h"
+
+#include <furi.h>
+
+// Geometry from layout.h: HH:MM left of the gutter, and in the gutter two
+// small digits stacked (tens on top) or the seconds grid. At 128x64 the grid
+// is 6 ticks per row (1 px wide, 1 px apart = 11 px) and 10 rows (3 px tall,
+// 1 px apart = 40 px), which leaves room for AM/PM below.
+#define DIGIT_W   SEG_DIGIT_W
+#define DIGIT_H   SEG_DIGIT_H
+#define DIGIT_T   SEG_DIGIT_T
+#define COLON_W   SEG_COLON_W
+#define SMALL_W   SEG_SMALL_W
+#define SMALL_H   SEG_SMALL_H
+#define SMALL_T   SEG_SMALL_T
+#define SMALL_GAP SEG_SMALL_GAP
+#define GUTTER_X  SEG_GUTTER_X
+#define GRID_COLS SEG_GRID_COLS
+#define GRID_ROWS SEG_GRID_ROWS
+#define TICK_W    SEG_TICK_W
+#define TICK_H    SEG_TICK_H
+#define TICK_GAP  SEG_TICK_GAP
+#define ROW_H     SEG_ROW_H
+
+static const uint8_t big_x[4] = {SEG_X_H0, SEG_X_H1, SEG_X_M0, SEG_X_M1};
+static const FaceRect grid_rect = {GUTTER_X, 0, SMALL_W, SEG_GRID_H};
+
+typedef struct {
+    const DigitSet* big;     // from the glyph cache
+    const DigitSet* small;
+    Readout r;       // last Readout; render draws this one
+    bool fresh;      // no Readout yet
+    int8_t ticks;    // seconds ticks in the frame
+} SegFace;
+
+static FaceRect big_rect(int i) {
+    return (FaceRect){big_x[i], 0, DIGIT_W, DIGIT_H};
+}
+
+static FaceRect small_rect(int i) {
+    return (FaceRect){GUTTER_X, (uint8_t)(i * (SMALL_H + SMALL_GAP)), SMALL_W, SMALL_H};
+}
+
+// Rows of the grid that change going from `from` ticks to `to`. Only a
+// rollover (or blanking) touches the whole grid.
+static FaceRect grid_damage(int from, int to) {
+    if(to <= from) return grid_rect;
+    const int row0 = from / GRID_COLS;
+    const int row1 = (MIN(to, GRID_COLS * GRID_ROWS) - 1) / GRID_COLS;
+    const int h = (row1 - row0) * ROW_H + TICK_H;
+    return (FaceRect){GUTTER_X, (uint8_t)(row0 * ROW_H), SMALL_W, (uint8_t)h};
+}
+
+static void* seg_init(void) {
+    SegFace* s = malloc(sizeof(SegFace));
+    memset(s, 0, sizeof(SegFace));
+    s->big = digitset_get(DIGIT_W, DIGIT_H, DIGIT_T);
+    s->small = digitset_get(SMALL_W, SMALL_H, SMALL_T);
+    s->fresh = true;
+    return s;
+}
+
+static void seg_deinit(void* face) {
+    SegFace* s = face;
+    digitset_put(s->big);
+    digitset_put(s->small);
+    free(s);
+}
+
+static int seg_on_tick(void* face, const Readout* r, FaceRect* damage, uint8_t* next_s) {
+    SegFace* s = face;
+    const Readout* old = &s->r;
+    int n = 0;
+
+    if(s->fresh || r->small != old->small) {
+        damage[n++] = face_screen;
+    } else {
+        for(int i = 0; i < 4; i++) {
+            if(r->big[i] != old->big[i]) damage[n++] = big_rect(i);
+        }
+        if(r->small) {
+            for(int i = 0; i < 2; i++) {
+                if(r->small_digit[i] != old->small_digit[i]) damage[n++] = small_rect(i);
+            }
+        } else if(r->grid != old->grid) {
+            damage[n++] = grid_damage(old->grid, r->grid);
+        }
+    }
+
+    s->r = *r;
+    s->fresh = false;
+    *next_s = readout_next_s(r);
+    return n;
+}
+
+// d is -1 to mean "blank" (used for leading zero in hours).
+static void draw_digit(Frame* f, const DigitSet* set, const FaceRect* at, int d) {
+    if(d < 0 || d > 9) {
+        frame_box(f, at->x, at->y, at->w, at->h, false);
+    } else {
+        frame_blit(f, at->x, at->y, at->w, at->h, digitset_glyph(set, d));
+    }
+}
+
+static void seg_render(void* face, Frame* f, const FaceRect* region) {
+    SegFace* s = face;
+
+    if(region->w == FRAME_W && region->h == FRAME_H) {
+        frame_clear(f);
+        // Two square dots between HH and MM.
+        frame_box(f, SEG_X_CO, SEG_COLON_Y0, COLON_W, COLON_W, true);
+        frame_box(f, SEG_X_CO, SEG_COLON_Y1, COLON_W, COLON_W, true);
+        s->ticks = 0;
+    }
+
+    for(int i = 0; i < 4; i++) {
+        const FaceRect at = big_rect(i);
+        if(face_overlaps(region, &at)) draw_digit(f, s->big, &at, s->r.big[i]);
+    }
+
+    if(s->r.small) {
+        for(int i = 0; i < 2; i++) {
+            const FaceRect at = small_rect(i);
+            if(face_overlaps(region, &at)) draw_digit(f, s->small, &at, s->r.small_digit[i]);
+        }
+    } else if(face_overlaps(region, &grid_rect)) {
+        // Filled top-down and left to right, one tick per second. Fewer ticks
+        // than drawn means the minute rolled over: clear once, then just add
+        // the missing ticks.
+        const int count = s->r.grid;
+        int drawn = s->ticks;
+        if(drawn > count) {
+            frame_box(f, grid_rect.x, grid_rect.y, grid_rect.w, grid_rect.h, false);
+            drawn = 0;
+        }
+        for(int i = drawn; i < count && i < GRID_COLS * GRID_ROWS; i++) {
+            const int x = GUTTER_X + (i % GRID_COLS) * (TICK_W + TICK_GAP);
+            const int y = (i / GRID_COLS) * ROW_H;
+            frame_box(f, x, y, TICK_W, TICK_H, true);
+        }
+        s->ticks = (int8_t)count;
+    }
+}
+
+const ClockFace seg_face = {
+    .init = seg_init,
+    .deinit = seg_deinit,
+    .on_tick = seg_on_tick,
+    .render = seg_render,
+};
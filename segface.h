@@ -0,0 +1,13 @@
+#pragma once
+
+#include "face.h"
+
+// ----------------------------------------------------------------------------
+// Seven-segment face
+// ----------------------------------------------------------------------------
+//
+// The landscape digital face: HH:MM in 23x64 digits, the gutter on the right
+// holding either two 11x19 digits or the 60-step seconds grid. Each digit is
+// its own damage rectangle; the grid reports only the rows that gain ticks.
+//
+extern const ClockFace seg_face;
@@ -0,0 +1,286 @@
+#include "settings.h"
+
+#if BIGCLOCK_SETTINGS
+
+#include <furi.h>
+#include <gui/view_dispatcher.h>
+#include <gui/modules/variable_item_list.h>
+
+#include <stddef.h>
+#include <stdio.h>
+
+#define SETTINGS_VIEW   0
+#define SETTINGS_ALARMS 16   // alarms the menu edits (the rest keep their state)
+
+static const char* const off_on[] = {"Off", "On"};
+static const char* const face_names[] = {"Digital", "Analog", "Binary"};
+static const char* const backlight_names[] = {"On", "Night dim", "Off"};
+static const char* const chime_names[] = {"Off", "Hourly", "Quarter"};
+static const uint8_t dim_levels[] = {4, 8, 16, 32, 64, 128, 192, 255};
+static const uint8_t light_times[] = {2, 5, 10, 15, 30, 60, 120, 255};
+static const uint8_t fps_caps[] = {1, 2, 5, 10, 20, 25, 50};
+
+// One menu line: a byte of SettingsValues, shown by name, or by printing the
+// stored value with fmt (values maps the item's index to the stored value).
+typedef struct {
+    const char* label;
+    uint8_t count;
+    uint8_t offset;
+    const char* const* names;
+    const uint8_t* values;
+    const char* fmt;
+} ItemDef;
+
+#define FIELD(f) offsetof(SettingsValues, f)
+
+static const ItemDef item_defs[] = {
+    {"Face", 3, FIELD(face), face_names, NULL, NULL},
+    {"Seconds", 2, FIELD(seconds), off_on, NULL, NULL},
+    {"24-hour", 2, FIELD(mode_24h), off_on, NULL, NULL},
+    {"Portrait", 2, FIELD(portrait), off_on, NULL, NULL},
+    {"Inverted", 2, FIELD(inverted), off_on, NULL, NULL},
+    {"Backlight", 3, FIELD(backlight), backlight_names, NULL, NULL},
+    {"Dim from", 24, FIELD(dim_from), NULL, NULL, "%02u:00"},
+    {"Dim until", 24, FIELD(dim_to), NULL, NULL, "%02u:00"},
+    {"Dim level", COUNT_OF(dim_levels), FIELD(dim_level), NULL, dim_levels, "%u/255"},
+    {"Light for", COUNT_OF(light_times), FIELD(light_secs), NULL, light_times, "%u s"},
+    {"Chime", 3, FIELD(chime), chime_names, NULL, NULL},
+    {"Quiet from", 24, FIELD(quiet_from), NULL, NULL, "%02u:00"},
+    {"Quiet until", 24, FIELD(quiet_to), NULL, NULL, "%02u:00"},
+    {"Stopwatch", COUNT_OF(fps_caps), FIELD(stopwatch_fps), NULL, fps_caps, "%u fps"},
+};
+
+#define ITEMS COUNT_OF(item_defs)
+
+// The alarm editor: one alarm at a time, chosen on the "Alarm" line (its
+// last entry, "New", appends). Every edit goes straight through alarms_set,
+// which reschedules, so the list is always valid and in step.
+typedef enum {
+    AlarmPick,
+    AlarmHour,
+    AlarmMinute,
+    AlarmDay,                  // Mon .. Sun
+    AlarmOn = AlarmDay + 7,
+    AlarmDelete,
+    AlarmLines,
+} AlarmLine;
+
+static const char* const alarm_labels[AlarmLines] = {
+    "Alarm", " Hour", " Minute", " Mon", " Tue", " Wed", " Thu", " Fri", " Sat", " Sun",
+    " Enabled", " Delete (OK)"};
+
+// Values per line; the picker's count follows the list (alarm_picks).
+static const uint8_t alarm_counts[AlarmLines] = {1, 24, 60, 2, 2, 2, 2, 2, 2, 2, 2, 1};
+
+// What "New" starts as.
+static const Alarm alarm_new = {7, 0, ALARM_DAYS_ALL, ALARM_ENABLED};
+
+typedef struct Settings Settings;
+
+typedef struct {
+    Settings* s;
+    uint16_t index;          // item_defs entry, or AlarmLine
+} ItemCtx;
+
+struct Settings {
+    SettingsValues* v;
+    ViewDispatcher* vd;
+    VariableItemList* list;
+    bool changed;
+    ItemCtx item[ITEMS];
+    ItemCtx alarm[AlarmLines];
+    VariableItem* alarm_item[AlarmLines];
+    uint16_t sel;            // alarm being edited; == count for "New"
+    Alarm draft;             // its fields
+    char text[10];
+};
+
+static void item_text(Settings* s, VariableItem* item, const ItemDef* d, uint8_t index) {
+    if(d->names) {
+        variable_item_set_current_value_text(item, d->names[index]);
+        return;
+    }
+    snprintf(s->text, sizeof(s->text), d->fmt, d->values ? d->values[index] : index);
+    variable_item_set_current_value_text(item, s->text);
+}
+
+static void item_changed(VariableItem* item) {
+    ItemCtx* c = variable_item_get_context(item);
+    const ItemDef* d = &item_defs[c->index];
+    const uint8_t index = variable_item_get_current_value_index(item);
+
+    ((uint8_t*)c->s->v)[d->offset] = d->values ? d->values[index] : index;
+    c->s->changed = true;
+    item_text(c->s, item, d, index);
+}
+
+// Alarms the picker offers: the first SETTINGS_ALARMS, then "New" if there
+// is room.
+static uint16_t alarm_picks(const Settings* s) {
+    const uint16_t count = s->v->alarms->count;
+    return MIN(count, SETTINGS_ALARMS) + (count < SETTINGS_ALARMS ? 1 : 0);
+}
+
+static uint8_t alarm_line_index(const Settings* s, AlarmLine line) {
+    const Alarm* a = &s->draft;
+    switch(line) {
+    case AlarmPick:
+        return s->sel;
+    case AlarmHour:
+        return a->hour;
+    case AlarmMinute:
+        return a->minute;
+    case AlarmOn:
+        return (a->flags & ALARM_ENABLED) ? 1 : 0;
+    case AlarmDelete:
+        return 0;
+    default:
+        return (a->days >> (line - AlarmDay)) & 1;
+    }
+}
+
+static void alarm_line_text(Settings* s, AlarmLine line) {
+    VariableItem* item = s->alarm_item[line];
+    const uint8_t index = alarm_line_index(s, line);
+    switch(line) {
+    case AlarmPick:
+        if(s->sel == s->v->alarms->count) {
+            snprintf(s->text, sizeof(s->text), "New");
+        } else {
+            const Alarm* a = &s->draft;
+            snprintf(s->text, sizeof(s->text), "#%u %02u:%02u", s->sel + 1, a->hour, a->minute);
+        }
+        break;
+    case AlarmHour:
+    case AlarmMinute:
+        snprintf(s->text, sizeof(s->text), "%02u", index);
+        break;
+    case AlarmDelete:
+        snprintf(s->text, sizeof(s->text), "%s", s->sel < s->v->alarms->count ? "" : "-");
+        break;
+    default:
+        snprintf(s->text, sizeof(s->text), "%s", off_on[index]);
+        break;
+    }
+    variable_item_set_current_value_text(item, s->text);
+}
+
+// Show alarm s->sel (or a fresh "New") on every editor line.
+static void alarm_show(Settings* s) {
+    const Alarms* al = s->v->alarms;
+    s->draft = s->sel < al->count ? al->items[s->sel] : alarm_new;
+    variable_item_set_values_count(s->alarm_item[AlarmPick], alarm_picks(s));
+    for(uint8_t line = 0; line < AlarmLines; line++) {
+        variable_item_set_current_value_index(s->alarm_item[line], alarm_line_index(s, line));
+        alarm_line_text(s, line);
+    }
+}
+
+static void alarm_changed(VariableItem* item) {
+    ItemCtx* c = variable_item_get_context(item);
+    Settings* s = c->s;
+    const uint8_t index = variable_item_get_current_value_index(item);
+    Alarm* a = &s->draft;
+
+    switch(c->index) {
+    case AlarmPick:
+        s->sel = index;
+        alarm_show(s);
+        return;
+    case AlarmHour:
+        a->hour = index;
+        break;
+    case AlarmMinute:
+        a->minute = index;
+        break;
+    case AlarmOn:
+        a->flags = index ? (a->flags | ALARM_ENABLED) : (a->flags & ~ALARM_ENABLED);
+        break;
+    case AlarmDelete:
+        return;
+    default:
+        a->days ^= 1 << (c->index - AlarmDay);
+        break;
+    }
+
+    // Editing "New" appends it; the picker then has it (and maybe a new "New").
+    const bool added = s->sel == s->v->alarms->count;
+    if(!alarms_set(s->v->alarms, s->sel, a, s->v->now)) return;
+    s->v->alarms_changed = true;
+    s->changed = true;
+    if(added) variable_item_set_values_count(s->alarm_item[AlarmPick], alarm_picks(s));
+    alarm_line_text(s, c->index);
+    alarm_line_text(s, AlarmPick);
+    alarm_line_text(s, AlarmDelete);
+}
+
+// OK on "Delete": remove the alarm being edited and show the one after it.
+static void settings_enter(void* ctx, uint32_t index) {
+    Settings* s = ctx;
+    if(index != ITEMS + AlarmDelete || s->sel >= s->v->alarms->count) return;
+
+    alarms_delete(s->v->alarms, s->sel, s->v->now);
+    s->v->alarms_changed = true;
+    s->changed = true;
+    alarm_show(s);
+}
+
+// Index of the stored value: itself, or the nearest entry of values.
+static uint8_t item_index(const ItemDef* d, uint8_t value) {
+    if(!d->values) return MIN(value, d->count - 1);
+    uint8_t best = 0;
+    for(uint8_t i = 1; i < d->count; i++) {
+        if(abs(d->values[i] - value) < abs(d->values[best] - value)) best = i;
+    }
+    return best;
+}
+
+static bool settings_back(void* ctx) {
+    Settings* s = ctx;
+    view_dispatcher_stop(s->vd);
+    return true;
+}
+
+bool settings_run(Gui* gui, SettingsValues* v) {
+    Settings* s = malloc(sizeof(Settings));
+    memset(s, 0, sizeof(Settings));
+    s->v = v;
+    s->list = variable_item_list_alloc();
+
+    for(uint16_t i = 0; i < ITEMS; i++) {
+        const ItemDef* d = &item_defs[i];
+        const uint8_t index = item_index(d, ((const uint8_t*)v)[d->offset]);
+        s->item[i] = (ItemCtx){s, i};
+        VariableItem* item =
+            variable_item_list_add(s->list, d->label, d->count, item_changed, &s->item[i]);
+        variable_item_set_current_value_index(item, index);
+        item_text(s, item, d, index);
+    }
+
+    for(uint8_t line = 0; line < AlarmLines; line++) {
+        s->alarm[line] = (ItemCtx){s, line};
+        s->alarm_item[line] = variable_item_list_add(
+            s->list, alarm_labels[line], alarm_counts[line], alarm_changed, &s->alarm[line]);
+    }
+    alarm_show(s);
+    variable_item_list_set_enter_callback(s->list, settings_enter, s);
+
+    s->vd = view_dispatcher_alloc();
+    view_dispatcher_add_view(s->vd, SETTINGS_VIEW, variable_item_list_get_view(s->list));
+    view_dispatcher_set_event_callback_context(s->vd, s);
+    view_dispatcher_set_navigation_event_callback(s->vd, settings_back);
+    view_dispatcher_attach_to_gui(s->vd, gui, ViewDispatcherTypeFullscreen);
+    view_dispatcher_switch_to_view(s->vd, SETTINGS_VIEW);
+
+    view_dispatcher_run(s->vd);
+
+    view_dispatcher_remove_view(s->vd, SETTINGS_VIEW);
+    view_dispatcher_free(s->vd);
+    variable_item_list_free(s->list);
+
+    const bool changed = s->changed;
+    free(s);
+    return changed;
+}
+
+#endif
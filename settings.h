@@ -0,0 +1,44 @@
+#pragma once
+
+#include "alarms.h"
+
+#include <gui/gui.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Settings menu
+// ----------------------------------------------------------------------------
+//
+// A VariableItemList in its own ViewDispatcher, built when the menu opens and
+// torn down before settings_run returns: the clock carries none of it while
+// it is just showing the time. Build with BIGCLOCK_SETTINGS=0 (cdefines in
+// application.fam) to leave it out altogether, e.g. to compare startup cost.
+//
+#ifndef BIGCLOCK_SETTINGS
+#define BIGCLOCK_SETTINGS 1
+#endif
+
+// What the menu edits, copied in and out by the app. Enums are the app's.
+typedef struct {
+    uint8_t face;        // Face
+    uint8_t seconds;     // 0/1: HH:MM:SS
+    uint8_t mode_24h;    // 0/1
+    uint8_t portrait;    // 0/1
+    uint8_t inverted;    // 0/1
+    uint8_t backlight;   // Backlight
+    uint8_t dim_from;    // hour
+    uint8_t dim_to;      // hour
+    uint8_t dim_level;   // 1..255
+    uint8_t light_secs;  // seconds a key press lights the backlight (Backlight off)
+    uint8_t chime;       // Chime
+    uint8_t quiet_from;  // hour: no chimes from...
+    uint8_t quiet_to;    // ...until this hour (== quiet_from: never quiet)
+    uint8_t stopwatch_fps; // refresh cap while the stopwatch runs
+    Alarms* alarms;      // edited in place (alarms_set, alarms_delete)
+    bool alarms_changed;
+    uint32_t now;        // RTC time the menu opened, for rescheduling edits
+} SettingsValues;
+
+// Show the menu on gui until BACK. Blocks; runs the menu on the calling
+// thread. Returns true if anything was changed.
+bool settings_run(Gui* gui, SettingsValues* v);
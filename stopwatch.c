@@ -0,0 +1,31 @@
+#include "stopwatch.h"
+
+#include <string.h>
+
+void stopwatch_reset(Stopwatch* sw) {
+    memset(sw, 0, sizeof(*sw));
+}
+
+void stopwatch_toggle(Stopwatch* sw, uint32_t at) {
+    if(sw->running) {
+        sw->banked += at - sw->start;
+        sw->running = false;
+    } else {
+        sw->start = at;
+        sw->running = true;
+    }
+}
+
+void stopwatch_lap(Stopwatch* sw, uint32_t at) {
+    if(!sw->running) return;
+
+    const uint32_t elapsed = stopwatch_elapsed(sw, at);
+    sw->last_lap = elapsed - sw->lap_mark;
+    sw->lap_mark = elapsed;
+    sw->laps++;
+}
+
+uint32_t stopwatch_elapsed(const Stopwatch* sw, uint32_t now) {
+    // Unsigned subtraction keeps this right across tick counter wraparound.
+    return sw->banked + (sw->running ? now - sw->start : 0);
+}
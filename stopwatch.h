@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Stopwatch
+// ----------------------------------------------------------------------------
+//
+// Pure state machine driven by explicit tick timestamps. The app passes the
+// tick captured in input_cb at the moment of the key press, so how long the
+// event sat in the queue never shows up in the recorded times.
+//
+typedef struct {
+    bool running;
+    uint32_t start;      // tick the current run started (valid while running)
+    uint32_t banked;     // ticks accumulated by earlier runs
+    uint32_t lap_mark;   // elapsed ticks at the previous lap (or 0)
+    uint32_t laps;       // laps taken since reset
+    uint32_t last_lap;   // duration of the most recent lap, in ticks
+} Stopwatch;
+
+void stopwatch_reset(Stopwatch* sw);
+
+// Start if stopped, stop if running, at tick `at`.
+void stopwatch_toggle(Stopwatch* sw, uint32_t at);
+
+// Record a lap at tick `at`. Ignored while stopped.
+void stopwatch_lap(Stopwatch* sw, uint32_t at);
+
+// Elapsed ticks as of tick `now`.
+uint32_t stopwatch_elapsed(const Stopwatch* sw, uint32_t now);
@@ -0,0 +1,152 @@
+#include "sun.h"
+
+#include <ctype.h>
+
+// sin(d degrees) in Q14, d = 0..90.
+static const int16_t sin90[91] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+#define Q14 16384
+
+int32_t sun_sin(int32_t cdeg) {
+    cdeg %= 36000;
+    if(cdeg < 0) cdeg += 36000;
+
+    // Fold into the first quadrant, remembering the sign.
+    int32_t sign = 1;
+    if(cdeg >= 18000) {
+        cdeg -= 18000;
+        sign = -1;
+    }
+    if(cdeg > 9000) cdeg = 18000 - cdeg;
+
+    const int32_t d = cdeg / 100;
+    const int32_t frac = cdeg % 100;
+    const int32_t lo = sin90[d];
+    const int32_t hi = (d < 90) ? sin90[d + 1] : lo;
+    return sign * (lo + ((hi - lo) * frac + 50) / 100);
+}
+
+static int32_t sun_cos(int32_t cdeg) {
+    return sun_sin(cdeg + 9000);
+}
+
+// acos of a Q14 value in [-Q14, Q14], in hundredths of a degree. cos falls
+// monotonically over 0..180 degrees, so bisect on the angle.
+static int32_t sun_acos(int32_t c) {
+    int32_t lo = 0;
+    int32_t hi = 18000;
+    while(lo < hi) {
+        const int32_t mid = (lo + hi) / 2;
+        if(sun_cos(mid) > c) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Days from 1970-01-01 to a civil date (proleptic Gregorian).
+static int32_t days_from_civil(int y, int m, int d) {
+    y -= (m <= 2);
+    const int32_t era = (y >= 0 ? y : y - 399) / 400;
+    const int32_t yoe = y - era * 400;
+    const int32_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// Moon: a new moon at 2000-01-06 18:14 UTC, mean synodic month in seconds.
+#define MOON_EPOCH   947182440LL
+#define MOON_SYNODIC 2551443LL
+
+void sun_day(SunDay* out, const SunPlace* place, int year, int month, int day) {
+    const int32_t days = days_from_civil(year, month, day);
+    const int32_t n = days - days_from_civil(year, 1, 1) + 1; // day of the year
+
+    // Declination, hundredths of a degree: -23.44 cos(360/365 (n + 10)).
+    const int32_t decl = -(2344 * sun_cos(36000 * (n + 10) / 365)) / Q14;
+
+    // Equation of time, hundredths of a minute:
+    // 9.87 sin 2B - 7.53 cos B - 1.5 sin B, B = 360/365 (n - 81).
+    const int32_t b = 36000 * (n - 81) / 365;
+    const int32_t eot = (987 * sun_sin(2 * b) - 753 * sun_cos(b) - 150 * sun_sin(b)) / Q14;
+
+    // Hour angle of sunrise: cos H = (sin(-0.83) - sin lat sin decl) / (cos lat cos decl).
+    const int32_t num = sun_sin(-83) - (sun_sin(place->lat) * sun_sin(decl)) / Q14;
+    const int32_t den = (sun_cos(place->lat) * sun_cos(decl)) / Q14;
+
+    // Solar noon in hundredths of a minute: 4 minutes per degree of longitude.
+    const int32_t noon = 72000 - 4 * place->lon - eot;
+
+    out->kind = SunNormal;
+    if(den <= 0) {
+        // At a pole: up all day exactly when it is above -0.83 degrees.
+        out->kind = (num < 0) ? SunPolarDay : SunPolarNight;
+    } else if(num >= den) {
+        out->kind = SunPolarNight;
+    } else if(num <= -den) {
+        out->kind = SunPolarDay;
+    }
+
+    if(out->kind == SunNormal) {
+        const int32_t h = sun_acos((num * Q14) / den);
+        out->rise = (int16_t)((noon - 4 * h + 50) / 100);
+        out->set = (int16_t)((noon + 4 * h + 50) / 100);
+    } else {
+        out->rise = out->set = (int16_t)(noon / 100);
+    }
+
+    // Moon age at noon UTC as a fraction of the synodic month.
+    int64_t age = ((int64_t)days * 86400 + 43200 - MOON_EPOCH) % MOON_SYNODIC;
+    if(age < 0) age += MOON_SYNODIC;
+    out->moon = (uint16_t)((age << 16) / MOON_SYNODIC);
+}
+
+// One signed decimal in hundredths; advances *p past it.
+static bool parse_cdeg(const char** p, int32_t* out) {
+    const char* s = *p;
+    while(isspace((unsigned char)*s) || *s == ',') s++;
+
+    const bool neg = (*s == '-');
+    if(*s == '-' || *s == '+') s++;
+    if(!isdigit((unsigned char)*s)) return false;
+
+    int32_t v = 0;
+    while(isdigit((unsigned char)*s)) v = v * 10 + (*s++ - '0');
+    v *= 100;
+    if(*s == '.') {
+        s++;
+        int32_t scale = 10;
+        while(isdigit((unsigned char)*s)) {
+            v += (*s++ - '0') * scale;
+            scale /= 10;
+        }
+    }
+
+    *out = neg ? -v : v;
+    *p = s;
+    return true;
+}
+
+bool sun_parse_place(SunPlace* place, const char* text) {
+    int32_t lat;
+    int32_t lon;
+    if(!parse_cdeg(&text, &lat) || !parse_cdeg(&text, &lon)) return false;
+    if(lat < -9000 || lat > 9000 || lon < -18000 || lon > 18000) return false;
+
+    place->lat = lat;
+    place->lon = lon;
+    return true;
+}
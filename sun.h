@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Sun and moon
+// ----------------------------------------------------------------------------
+//
+// Sunrise, sunset and moon phase for one day, all in integer arithmetic:
+// angles in hundredths of a degree, sines from a 1-degree Q14 table with
+// linear interpolation, acos by bisection over that table. The sunrise
+// model is the usual NOAA approximation (declination and equation of time
+// from the day of the year, -0.83 degrees for refraction and the sun's
+// radius); it lands within a couple of minutes of the full ephemeris
+// between the polar circles. Run once per day, not per frame.
+//
+
+// Latitude / longitude in hundredths of a degree, north and east positive.
+typedef struct {
+    int32_t lat;
+    int32_t lon;
+} SunPlace;
+
+typedef enum {
+    SunNormal,      // rises and sets
+    SunPolarDay,    // above the horizon all day
+    SunPolarNight,  // below the horizon all day
+} SunKind;
+
+typedef struct {
+    SunKind kind;
+    int16_t rise;     // minutes after 00:00 UTC; may fall outside 0..1439
+    int16_t set;
+    uint16_t moon;    // moon phase at 12:00 UTC, fraction of the cycle in 1/65536 (0 = new)
+} SunDay;
+
+// Compute SunDay for a calendar date at place.
+void sun_day(SunDay* out, const SunPlace* place, int year, int month, int day);
+
+// Parse "lat lon" in decimal degrees (e.g. "51.48 -0.01"). Up to two decimals
+// are kept. Returns false, leaving place alone, if the text doesn't parse.
+bool sun_parse_place(SunPlace* place, const char* text);
+
+// Sine of an angle in hundredths of a degree, Q14.
+int32_t sun_sin(int32_t cdeg);
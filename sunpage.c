@@ -0,0 +1,93 @@
+#include "sunpage.h"
+#include "glyphs.h"
+#include "layout.h"
+
+// Moon disc (layout.h).
+#define MOON_CX SUN_MOON_CX
+#define MOON_CY SUN_MOON_CY
+#define MOON_R  SUN_MOON_R
+
+// Times: small digits, an arrow in front of each row.
+#define DIGIT_W  SUN_DIGIT_W
+#define DIGIT_H  SUN_DIGIT_H
+#define DIGIT_T  SUN_DIGIT_T
+#define ROW_RISE SUN_ROW_RISE
+#define ROW_SET  SUN_ROW_SET
+#define ARROW_X  SUN_ARROW_X
+#define TIME_X   SUN_TIME_X
+
+static int isqrt(int v) {
+    int r = 0;
+    while((r + 1) * (r + 1) <= v) r++;
+    return r;
+}
+
+// Lit part of the disc, row by row: the terminator is an ellipse whose half
+// width is w cos(phase), so each row is one span. Waxing lights the right
+// side, waning the left. A ring around the disc keeps a new moon visible.
+static void draw_moon(Frame* f, uint16_t moon) {
+    const int32_t c = sun_sin((int32_t)(((uint32_t)moon * 36000) >> 16) + 9000); // Q14
+    const bool waxing = moon < 0x8000;
+
+    for(int dy = -MOON_R; dy <= MOON_R; dy++) {
+        const int ady = dy < 0 ? -dy : dy;
+        const int w = isqrt(MOON_R * MOON_R - dy * dy);
+        const int t = (w * c) / 16384;
+        const int y = MOON_CY + dy;
+
+        if(waxing) {
+            frame_box(f, MOON_CX + t, y, w - t + 1, 1, true);
+        } else {
+            frame_box(f, MOON_CX - w, y, w - t + 1, 1, true);
+        }
+
+        // Ring: from this row's edge in to the next row's, at least one pixel.
+        const int w_out = (ady < MOON_R) ? isqrt(MOON_R * MOON_R - (ady + 1) * (ady + 1)) : 0;
+        const int run = (w - w_out > 0) ? w - w_out : 1;
+        frame_box(f, MOON_CX - w, y, run, 1, true);
+        frame_box(f, MOON_CX + w - run + 1, y, run, 1, true);
+    }
+}
+
+// Small filled triangle, pointing up or down, 7 px wide.
+static void draw_arrow(Frame* f, int x, int y, bool up) {
+    for(int i = 0; i < 4; i++) {
+        const int yy = up ? y + i : y + 3 - i;
+        frame_box(f, x + 3 - i, yy, 2 * i + 1, 1, true);
+    }
+}
+
+static void draw_time(Frame* f, const DigitSet* set, int y, int minutes, bool valid) {
+    const int xs[4] = {
+        TIME_X, TIME_X + SUN_TIME_DX(1), TIME_X + SUN_TIME_DX(2), TIME_X + SUN_TIME_DX(3)};
+
+    minutes %= 1440;
+    if(minutes < 0) minutes += 1440;
+    const int d[4] = {minutes / 600, (minutes / 60) % 10, (minutes % 60) / 10, minutes % 10};
+
+    for(int i = 0; i < 4; i++) {
+        if(valid) {
+            frame_blit(f, xs[i], y, set->w, set->h, digitset_glyph(set, d[i]));
+        } else {
+            frame_box(f, xs[i], y + (DIGIT_H - DIGIT_T) / 2, DIGIT_W, DIGIT_T, true); // "-"
+        }
+    }
+    frame_box(f, TIME_X + SUN_COLON_DX, y + SUN_COLON_DY0, SUN_COLON_W, SUN_COLON_W, true);
+    frame_box(f, TIME_X + SUN_COLON_DX, y + SUN_COLON_DY1, SUN_COLON_W, SUN_COLON_W, true);
+}
+
+void sunpage_render(Frame* f, const SunDay* sd, int offset) {
+    const DigitSet* set = digitset_get(DIGIT_W, DIGIT_H, DIGIT_T);
+    frame_clear(f);
+
+    draw_moon(f, sd->moon);
+
+    // Rise and set, or dashes when the sun stays up or down all day.
+    const bool valid = (sd->kind == SunNormal);
+    draw_arrow(f, ARROW_X, ROW_RISE + SUN_ARROW_DY, true);
+    draw_time(f, set, ROW_RISE, sd->rise + offset, valid);
+    draw_arrow(f, ARROW_X, ROW_SET + SUN_ARROW_DY, false);
+    draw_time(f, set, ROW_SET, sd->set + offset, valid);
+
+    digitset_put(set);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "frame.h"
+#include "sun.h"
+
+// ----------------------------------------------------------------------------
+// Sun page
+// ----------------------------------------------------------------------------
+//
+// Today's moon phase drawn as a disc on the left, sunrise and sunset as
+// HH:MM on the right. Like the date page it only changes once a day, so the
+// caller renders it into a cached Frame and blits that.
+//
+
+// Render sd into f (cleared first). offset is local time minus UTC, in minutes.
+void sunpage_render(Frame* f, const SunDay* sd, int offset);
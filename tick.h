@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdbool.h>
+
+// ----------------------------------------------------------------------------
+// Tick order
+// ----------------------------------------------------------------------------
+//
+// How the main loop takes a timer event, with the app's pieces passed in so
+// tools/chimebench.c runs this same order on a host. Whether anything fell
+// due (a chime slot, an alarm, the dimmer, the battery sample) is checked
+// first; the redraw is then asked for and the lock let go, and only after
+// that is what fell due handled, under the lock again. A chime queued there
+// can't hold up that second's frame. bigclock.c takes every timer event
+// through tick_run and nowhere else.
+//
+typedef struct {
+    void (*lock)(void* ctx);
+    void (*unlock)(void* ctx);
+    bool (*due)(void* ctx);    // something fell due this tick (under the lock)
+    void (*redraw)(void* ctx); // the event's own work, then ask for the redraw
+    void (*handle)(void* ctx); // what fell due, then ask for a redraw if it shows
+} TickSteps;
+
+static inline void tick_run(const TickSteps* t, void* ctx) {
+    t->lock(ctx);
+    const bool due = t->due(ctx);
+    t->redraw(ctx);
+    t->unlock(ctx);
+
+    if(due) {
+        t->lock(ctx);
+        t->handle(ctx);
+        t->unlock(ctx);
+    }
+}
@@ -0,0 +1,146 @@
+// Host benchmark for the alarm list (alarms.c): what a rescheduling costs and
+// what the per-tick check costs, from 1 to 1,000 alarms.
+//
+//   cc -O2 -I. -Itools/host tools/alarmbench.c alarms.c tools/host/storage.c -o alarmbench
+//   ./alarmbench
+//
+// alarms_schedule walks the whole list and runs only when an alarm fires or
+// the list changes; alarms_due is the compare made every tick (tick_due), and
+// should cost the same whatever the list holds. Also checks the scheduled
+// time against the earliest alarm_next, and that a saved list reloads with
+// its out-of-range records (hour >= 24, minute >= 60) dropped.
+
+#include "alarms.h"
+
+#include <storage/storage.h>
+
+#include <stdio.h>
+#include <time.h>
+
+#define ROUNDS 2000000L // alarms_due calls per list size
+#define NOW    1790000000UL // an RTC timestamp (2026)
+
+static uint32_t seed = 12345;
+
+static uint32_t rnd(uint32_t n) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8) % n;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void fill(Alarms* al, uint16_t n) {
+    al->items = NULL;
+    al->count = 0;
+    for(uint16_t i = 0; i < n; i++) {
+        const Alarm a = {
+            .hour = rnd(24),
+            .minute = rnd(60),
+            .days = 1 + rnd(ALARM_DAYS_ALL),
+            .flags = rnd(8) ? ALARM_ENABLED : 0,
+        };
+        alarms_set(al, i, &a, NOW);
+    }
+}
+
+static int check_schedule(const Alarms* al, uint32_t now) {
+    uint32_t want = ALARM_NONE;
+    for(uint16_t i = 0; i < al->count; i++) {
+        const uint32_t t = alarm_next(&al->items[i], now);
+        if(t < want) want = t;
+    }
+    if(al->next == want && (want == ALARM_NONE || want > now)) return 0;
+    printf(
+        "FAIL: %u alarms: next %lu, want %lu\n",
+        al->count,
+        (unsigned long)al->next,
+        (unsigned long)want);
+    return 1;
+}
+
+static int check_load(void) {
+    Alarms al;
+    fill(&al, 100);
+    alarms_save(&al);
+
+    // Corrupt every tenth record on disk, alternately its hour and its
+    // minute: the header is 6 bytes, then 4 per alarm (hour, minute, ...).
+    size_t size;
+    uint8_t* data = host_file(APP_DATA_PATH("alarms.bin"), &size);
+    uint16_t bad = 0;
+    for(uint16_t i = 0; i < al.count; i += 10, bad++) {
+        uint8_t* rec = data + 6 + 4 * i;
+        if(bad % 2) {
+            rec[1] = 60 + rnd(196);
+        } else {
+            rec[0] = 24 + rnd(232);
+        }
+    }
+
+    Alarms back;
+    alarms_load(&back);
+    int fail = back.count != al.count - bad;
+    for(uint16_t i = 0, j = 0; i < al.count && !fail; i++) {
+        if(i % 10 == 0) continue;
+        fail = memcmp(&back.items[j++], &al.items[i], sizeof(Alarm)) != 0;
+    }
+    const Alarm out = {.hour = 24, .minute = 0, .days = ALARM_DAYS_ALL, .flags = ALARM_ENABLED};
+    if(alarms_set(&back, 0, &out, NOW)) fail = 1;
+    if(fail) {
+        printf(
+            "FAIL: reload kept %u of %u alarms, want %u\n",
+            back.count,
+            al.count,
+            al.count - bad);
+    }
+
+    alarms_free(&al);
+    alarms_free(&back);
+    return fail;
+}
+
+int main(void) {
+    static const uint16_t sizes[] = {1, 10, 100, 1000};
+    int fail = check_load();
+
+    printf("alarms   schedule      due (per tick)\n");
+    for(size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        Alarms al;
+        fill(&al, sizes[s]);
+
+        // Schedule from a spread of times, checking each result.
+        const long runs = ROUNDS / 100 / sizes[s] + 10;
+        double best_sched = 1e18;
+        for(int r = 0; r < 5; r++) {
+            const double t0 = now_ns();
+            for(long i = 0; i < runs; i++) alarms_schedule(&al, NOW + (uint32_t)i * 997);
+            const double t = (now_ns() - t0) / runs;
+            if(t < best_sched) best_sched = t;
+        }
+        for(int i = 0; i < 50; i++) {
+            const uint32_t now = NOW + rnd(14 * 86400);
+            alarms_schedule(&al, now);
+            fail |= check_schedule(&al, now);
+        }
+
+        // The tick: one compare against the precomputed time, a second apart.
+        alarms_schedule(&al, NOW);
+        volatile uint32_t hits = 0;
+        double best_due = 1e18;
+        for(int r = 0; r < 5; r++) {
+            const double t0 = now_ns();
+            for(long i = 0; i < ROUNDS; i++) hits += alarms_due(&al, NOW + (uint32_t)i);
+            const double t = (now_ns() - t0) / ROUNDS;
+            if(t < best_due) best_due = t;
+        }
+
+        printf("%6u %9.0f ns %12.2f ns\n", sizes[s], best_sched, best_due);
+        alarms_free(&al);
+    }
+    printf("%s\n", fail ? "FAILED" : "ok");
+    return fail;
+}
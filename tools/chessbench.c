@@ -0,0 +1,150 @@
+// Host harness for the chess clock (chess.c, countdown.c): press-to-accounting
+// latency, and the accounting itself.
+//
+//   cc -O2 -I. tools/chessbench.c chess.c countdown.c -o chessbench && ./chessbench
+//
+// Plays games of stamped presses. The app charges a switch inside input_cb,
+// at the tick stamped on the press, so the main loop (and a redraw it may be
+// busy with) never sits between the press and the accounting. Each game is
+// charged that way and, for comparison, at the tick the main loop would
+// handle the press (up to MAX_DELAY ticks later). Checks both sides' clocks
+// against the turn lengths between the stamps, times chess_press and
+// chess_poll, and checks that a press arriving after its side ran out, but
+// before chess_poll noticed, flags that side instead of passing the turn.
+
+#include "chess.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define GAMES     2000
+#define MOVES     60       // presses per game, alternating sides
+#define MAX_DELAY 300      // ticks a queued event may wait for the main loop
+#define HZ        1000
+#define BASE_S    (30 * 60)
+#define ROUNDS    1000000
+
+static uint32_t seed = 12345;
+
+static uint32_t rnd(uint32_t n) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8) % n;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// One game; returns the worst error (ticks) of either clock against the
+// stamped turn lengths; `delayed` charges each press up to MAX_DELAY ticks late.
+static uint32_t game(uint32_t start, bool delayed, int* fail) {
+    Chess ch;
+    chess_init(&ch, HZ, BASE_S);
+    uint32_t used[2] = {0, 0};
+    uint32_t t = start, worst = 0;
+
+    // Side 0 presses first and starts side 1's clock.
+    chess_press(&ch, 0, t);
+    for(int i = 1; i < MOVES; i++) {
+        const int side = i % 2;
+        const uint32_t turn = 1 + rnd(20 * HZ);
+        t += turn;
+        used[side] += turn;
+        const uint32_t at = delayed ? t + rnd(MAX_DELAY) : t;
+        if(!chess_press(&ch, side, at) || chess_poll(&ch, at)) {
+            printf("FAIL: press %d refused or flagged\n", i);
+            *fail = 1;
+        }
+        for(int s = 0; s < 2; s++) {
+            const uint32_t charged = BASE_S * HZ - countdown_left(&ch.side[s], at);
+            const int32_t err = (int32_t)(charged - used[s]);
+            const uint32_t e = err < 0 ? (uint32_t)-err : (uint32_t)err;
+            if(e > worst) worst = e;
+        }
+    }
+    if(ch.switches != MOVES - 1) *fail = 1;
+    return worst;
+}
+
+static void check_late_press(int* fail) {
+    Chess ch;
+    chess_init(&ch, HZ, 10);
+    chess_press(&ch, 0, 1000);            // side 1 to move, 10 s on its clock
+    const uint32_t out = 1000 + 10 * HZ;  // side 1 runs out here
+
+    // Pressed 5 ticks after running out; chess_poll hasn't run since.
+    const bool switched = chess_press(&ch, 1, out + 5);
+    const uint32_t left0 = countdown_left(&ch.side[0], out + 5000);
+    const bool reported = chess_poll(&ch, out + 6);
+    const bool again = chess_poll(&ch, out + 7);
+    if(switched || !ch.flagged || ch.turn != 1 || left0 != 10 * HZ || !reported || again) {
+        printf(
+            "FAIL: late press: switched %d flagged %d turn %d, side 0 left %lu, "
+            "reported %d/%d\n",
+            switched,
+            ch.flagged,
+            ch.turn,
+            (unsigned long)left0,
+            reported,
+            again);
+        *fail = 1;
+    }
+
+    // Pressed one tick before running out: an ordinary switch.
+    chess_init(&ch, HZ, 10);
+    chess_press(&ch, 0, 1000);
+    if(!chess_press(&ch, 1, out - 1) || ch.flagged || chess_poll(&ch, out)) {
+        printf("FAIL: press just in time was not a switch\n");
+        *fail = 1;
+    }
+}
+
+int main(void) {
+    int fail = 0;
+    uint32_t worst_stamped = 0, worst_delayed = 0;
+
+    for(int g = 0; g < GAMES; g++) {
+        // Every eighth game crosses the tick counter wrap.
+        const uint32_t start = (g % 8 == 0) ? UINT32_MAX - rnd(600 * HZ) : rnd(1000000);
+        const uint32_t saved = seed;
+        const uint32_t a = game(start, false, &fail);
+        seed = saved; // same turns, charged late
+        const uint32_t b = game(start, true, &fail);
+        if(a > worst_stamped) worst_stamped = a;
+        if(b > worst_delayed) worst_delayed = b;
+    }
+    if(worst_stamped) {
+        printf("FAIL: stamped accounting off by %lu ticks\n", (unsigned long)worst_stamped);
+        fail = 1;
+    }
+    check_late_press(&fail);
+
+    // Cost of the accounting itself: one switch, and one poll between switches.
+    Chess ch;
+    chess_init(&ch, HZ, BASE_S);
+    chess_press(&ch, 0, 0);
+    double best_press = 1e18, best_poll = 1e18;
+    for(int r = 0; r < 5; r++) {
+        double t0 = now_ns();
+        for(uint32_t i = 1; i <= ROUNDS; i++) chess_press(&ch, ch.turn, i);
+        const double press = (now_ns() - t0) / ROUNDS;
+        t0 = now_ns();
+        for(uint32_t i = 1; i <= ROUNDS; i++) chess_poll(&ch, ROUNDS + i);
+        const double poll = (now_ns() - t0) / ROUNDS;
+        if(press < best_press) best_press = press;
+        if(poll < best_poll) best_poll = poll;
+    }
+
+    printf(
+        "%d games of %d presses: charged at the press, clocks exact (0 ticks); "
+        "charged in the main loop, off by up to %lu ticks\n",
+        GAMES,
+        MOVES,
+        (unsigned long)worst_delayed);
+    printf(
+        "press to accounted: %.1f ns (chess_press), poll %.1f ns\n", best_press, best_poll);
+    printf("%s\n", fail ? "FAILED" : "ok");
+    return fail;
+}
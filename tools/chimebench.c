@@ -0,0 +1,276 @@
+// Host benchmark for chimes: redraw latency at a chime slot vs any other tick.
+//
+//   cc -O2 -I. -Itools/host tools/chimebench.c frame.c -lpthread -o chimebench && ./chimebench
+//
+// Runs the app's own tick order, tick_run from tick.h, which bigclock.c's
+// main loop takes every timer event through. Around it are host stand-ins
+// for the app's threads with the same locking: a GUI thread that draws a full
+// clock frame under the app mutex whenever a redraw is asked for, and a
+// notification thread playing sequences. Time runs 100x fast (a 10 ms tick, a
+// chime sequence 4.5 ms). Every CHIME_EVERY-th tick is a chime slot. Latency
+// is from the tick's stamp to its frame being drawn, split by slot kind:
+//
+//   app       tick_run, the chime queued (notification_message) in handle
+//   blocking  tick_run, but the chime plays to the end under the mutex, as
+//             notification_message_block would
+//   before    for comparison, a hand-written model of the old order: the
+//             chime queued before the redraw is asked for, in one section
+//
+// Checked for app and blocking, which run the real order: at every chime
+// slot the redraw was asked for and the mutex let go before the chime was
+// handled. Moving the handling in tick_run ahead of the redraw fails this on
+// the first slot. Also, in the app order a chime slot must on average be
+// drawn as soon as any other tick (within SLACK_NS of host scheduling noise).
+
+#include "frame.h"
+#include "tick.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define TICKS       300
+#define TICK_NS     10000000.0 // one simulated second
+#define CHIME_EVERY 15
+#define CHIME_NS    4500000.0  // sequence_chime_hour, ~450 ms at full speed
+#define SLACK_NS    500000.0   // scheduling noise allowed in the app check
+
+typedef enum {
+    OrderApp,
+    OrderBlocking,
+    OrderBefore,
+    OrderCount,
+} Order;
+
+static const char* const order_names[OrderCount] = {"app", "blocking", "before"};
+
+typedef struct {
+    uint32_t n;
+    double sum, worst;
+} Stats;
+
+typedef struct {
+    Order order;
+    pthread_mutex_t mutex;    // app->mutex
+    pthread_mutex_t lock;     // guards what follows (view_port_update, the notif queue)
+    pthread_cond_t update;
+    pthread_cond_t notify;
+    bool requested;
+    bool req_chime;
+    double req_ns;
+    uint32_t queued;          // chime sequences waiting to play
+    bool quit;
+    Frame frame;
+    Stats chime, other;
+
+    // The tick tick_run is on, and what the order check sees of it.
+    double stamp;
+    bool due;
+    uint32_t unlocks;         // app mutex releases so far
+    uint32_t asked_at;        // unlocks when this tick's redraw was asked for
+    bool asked;               // this tick's redraw has been asked for
+    uint32_t misordered;      // chime slots handled before their redraw was out
+} Sim;
+
+static uint8_t big[BITMAP_STRIDE(23) * 64];
+static uint8_t small[BITMAP_STRIDE(11) * 19];
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void sleep_until(double t) {
+    const double d = t - now_ns();
+    if(d <= 0) return;
+    const struct timespec ts = {(time_t)(d / 1e9), (long)((long long)d % 1000000000LL)};
+    nanosleep(&ts, NULL);
+}
+
+// A "digit 8" box glyph, as tools/framebench.c draws it.
+static void glyph(uint8_t* px, int w, int h, int t) {
+    bitmap_box(px, w, h, 0, 0, w, h, true);
+    bitmap_box(px, w, h, t, t, w - 2 * t, h / 2 - t - t / 2, false);
+    bitmap_box(px, w, h, t, h / 2 + t / 2, w - 2 * t, h - t - (h / 2 + t / 2), false);
+}
+
+// draw_cb: a full clock frame, under the app mutex.
+static void* gui_thread(void* ctx) {
+    Sim* sim = ctx;
+    while(true) {
+        pthread_mutex_lock(&sim->lock);
+        while(!sim->requested && !sim->quit) pthread_cond_wait(&sim->update, &sim->lock);
+        if(!sim->requested) {
+            pthread_mutex_unlock(&sim->lock);
+            return NULL;
+        }
+        const double req = sim->req_ns;
+        const bool chime = sim->req_chime;
+        sim->requested = false;
+        pthread_mutex_unlock(&sim->lock);
+
+        pthread_mutex_lock(&sim->mutex);
+        Frame* f = &sim->frame;
+        frame_clear(f);
+        for(int d = 0; d < 4; d++) frame_blit(f, 2 + d * 26 + (d > 1) * 10, 0, 23, 64, big);
+        frame_blit(f, 116, 0, 11, 19, small);
+        frame_blit(f, 116, 21, 11, 19, small);
+        pthread_mutex_unlock(&sim->mutex);
+
+        const double lat = now_ns() - req;
+        Stats* s = chime ? &sim->chime : &sim->other;
+        s->n++;
+        s->sum += lat;
+        if(lat > s->worst) s->worst = lat;
+    }
+}
+
+// The notification service: plays queued sequences one after another.
+static void* notif_thread(void* ctx) {
+    Sim* sim = ctx;
+    pthread_mutex_lock(&sim->lock);
+    while(true) {
+        while(!sim->queued && !sim->quit) pthread_cond_wait(&sim->notify, &sim->lock);
+        if(!sim->queued) break;
+        sim->queued--;
+        pthread_mutex_unlock(&sim->lock);
+        sleep_until(now_ns() + CHIME_NS);
+        pthread_mutex_lock(&sim->lock);
+    }
+    pthread_mutex_unlock(&sim->lock);
+    return NULL;
+}
+
+// view_port_update: ask for a redraw (a pending one absorbs it).
+static void refresh(Sim* sim, double stamp, bool chime) {
+    pthread_mutex_lock(&sim->lock);
+    if(!sim->requested) {
+        sim->requested = true;
+        sim->req_ns = stamp;
+        sim->req_chime = chime;
+    }
+    pthread_cond_signal(&sim->update);
+    pthread_mutex_unlock(&sim->lock);
+}
+
+// handle_chime, called with the app mutex held.
+static void chime(Sim* sim) {
+    if(sim->order == OrderBlocking) {
+        sleep_until(now_ns() + CHIME_NS);
+        return;
+    }
+    pthread_mutex_lock(&sim->lock);
+    sim->queued++;
+    pthread_cond_signal(&sim->notify);
+    pthread_mutex_unlock(&sim->lock);
+}
+
+// tick_run's steps, with the app mutex as the lock.
+static void sim_lock(void* ctx) {
+    pthread_mutex_lock(&((Sim*)ctx)->mutex);
+}
+
+static void sim_unlock(void* ctx) {
+    Sim* sim = ctx;
+    sim->unlocks++;
+    pthread_mutex_unlock(&sim->mutex);
+}
+
+static bool sim_due(void* ctx) {
+    return ((Sim*)ctx)->due;
+}
+
+static void sim_redraw(void* ctx) {
+    Sim* sim = ctx;
+    refresh(sim, sim->stamp, sim->due);
+    sim->asked = true;
+    sim->asked_at = sim->unlocks;
+}
+
+static void sim_handle(void* ctx) {
+    Sim* sim = ctx;
+    if(!sim->asked || sim->unlocks == sim->asked_at) sim->misordered++;
+    chime(sim);
+}
+
+static const TickSteps sim_steps = {
+    .lock = sim_lock,
+    .unlock = sim_unlock,
+    .due = sim_due,
+    .redraw = sim_redraw,
+    .handle = sim_handle,
+};
+
+static void run(Sim* sim, Order order) {
+    memset(sim, 0, sizeof(*sim));
+    sim->order = order;
+    pthread_mutex_init(&sim->mutex, NULL);
+    pthread_mutex_init(&sim->lock, NULL);
+    pthread_cond_init(&sim->update, NULL);
+    pthread_cond_init(&sim->notify, NULL);
+    pthread_t gui, notif;
+    pthread_create(&gui, NULL, gui_thread, sim);
+    pthread_create(&notif, NULL, notif_thread, sim);
+
+    // The main loop: each tick is stamped when the timer fires, then handled.
+    const double start = now_ns() + TICK_NS;
+    for(int i = 0; i < TICKS; i++) {
+        sim->stamp = start + i * TICK_NS;
+        sim->due = i % CHIME_EVERY == 0;
+        sim->asked = false;
+        sleep_until(sim->stamp);
+
+        if(order != OrderBefore) {
+            tick_run(&sim_steps, sim);
+        } else {
+            pthread_mutex_lock(&sim->mutex);
+            if(sim->due) chime(sim);
+            refresh(sim, sim->stamp, sim->due);
+            pthread_mutex_unlock(&sim->mutex);
+        }
+    }
+
+    sleep_until(now_ns() + TICK_NS);
+    pthread_mutex_lock(&sim->lock);
+    sim->quit = true;
+    pthread_cond_broadcast(&sim->update);
+    pthread_cond_broadcast(&sim->notify);
+    pthread_mutex_unlock(&sim->lock);
+    pthread_join(gui, NULL);
+    pthread_join(notif, NULL);
+}
+
+int main(void) {
+    glyph(big, 23, 64, 7);
+    glyph(small, 11, 19, 2);
+
+    static Sim sim;
+    int fail = 0;
+    printf("order     chime slot mean/worst   other mean/worst  (us, %d ticks)\n", TICKS);
+    for(Order o = 0; o < OrderCount; o++) {
+        run(&sim, o);
+        const Stats* c = &sim.chime;
+        const Stats* n = &sim.other;
+        printf(
+            "%-8s %9.0f %9.0f %11.0f %9.0f\n",
+            order_names[o],
+            c->sum / c->n / 1e3,
+            c->worst / 1e3,
+            n->sum / n->n / 1e3,
+            n->worst / 1e3);
+        if(o != OrderBefore && sim.misordered) {
+            printf(
+                "FAIL: %lu chime slots handled before their redraw was asked for\n",
+                (unsigned long)sim.misordered);
+            fail = 1;
+        }
+        if(o == OrderApp && c->sum / c->n > n->sum / n->n + SLACK_NS) {
+            printf("FAIL: chime slots drawn later than other ticks\n");
+            fail = 1;
+        }
+    }
+    printf("%s\n", fail ? "FAILED" : "ok");
+    return fail;
+}
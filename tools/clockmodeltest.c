@@ -0,0 +1,149 @@
+// Host check for the clock model (clockmodel.c): every second of the day under
+// every settings combination, and what the memo did to get there.
+//
+//   cc -O2 -I. tools/clockmodeltest.c clockmodel.c -o clockmodeltest && ./clockmodeltest
+//
+// For each of the 8 combinations of CLOCK_24H / CLOCK_SECONDS / CLOCK_FRUGAL,
+// walks seconds 0..86399 as the app does (each second asked for twice: the
+// tick, then draw_cb) and checks the Readout against the time worked out
+// independently here: digits and blanking, small digits or grid, the lit
+// label. The counters must show exactly one decode per minute, a seconds-only
+// update for the other 59 seconds and a plain hit for every second ask. Then
+// seconds in a scrambled order with the settings switching now and then:
+// each state must equal the one a fresh model gives, and each call must be
+// counted as the hit, minute hit or miss it should have been.
+
+#include "clockmodel.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define COMBOS   8
+#define SCRAMBLE 200000
+
+static uint32_t seed = 12345;
+
+static uint32_t rnd(uint32_t n) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8) % n;
+}
+
+// What the clock must show at second t under settings, worked out directly.
+static bool check(const Readout* r, uint32_t t, uint8_t settings) {
+    const int h24 = t / 3600, m = t / 60 % 60, s = t % 60;
+    const bool is24 = settings & CLOCK_24H;
+    const int h = is24 ? h24 : (h24 % 12 ? h24 % 12 : 12);
+
+    const int8_t big[4] = {(int8_t)(h < 10 && !is24 ? -1 : h / 10), h % 10, m / 10, m % 10};
+    if(memcmp(r->big, big, sizeof(big))) return false;
+    if(r->small != !!(settings & CLOCK_SECONDS)) return false;
+
+    if(settings & CLOCK_FRUGAL) {
+        if(r->small_digit[0] != -1 || r->small_digit[1] != -1 || r->grid != 0) return false;
+    } else if(r->small_digit[0] != s / 10 || r->small_digit[1] != s % 10 || r->grid != s + 1) {
+        return false;
+    }
+
+    const int slot = is24 ? 0 : (h24 >= 12 ? 2 : 1);
+    const char* want = is24 ? "24" : (h24 >= 12 ? "PM" : "AM");
+    for(int i = 0; i < 3; i++) {
+        if(i == slot ? (!r->label[i] || strcmp(r->label[i], want)) : r->label[i] != NULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static Readout readout(const DisplayState* s) {
+    Readout r;
+    memset(&r, 0, sizeof(r));
+    display_readout(s, &r);
+    return r;
+}
+
+int main(void) {
+    int fail = 0;
+
+    // In order, every second twice, as the tick and draw_cb ask for it.
+    for(uint8_t settings = 0; settings < COMBOS; settings++) {
+        ClockModel m;
+        clock_model_init(&m);
+        for(uint32_t t = 0; t < 86400; t++) {
+            const DisplayState* s = clock_model(&m, t, settings);
+            const DisplayState copy = *s;
+            const DisplayState* again = clock_model(&m, t, settings);
+            const Readout r = readout(again);
+            if(memcmp(&copy, again, sizeof(copy)) || !check(&r, t, settings)) {
+                printf("FAIL: settings %u, second %lu\n", settings, (unsigned long)t);
+                fail = 1;
+                break;
+            }
+        }
+        if(m.misses != 1440 || m.minute_hits != 86400 - 1440 || m.hits != 86400) {
+            printf(
+                "FAIL: settings %u: %lu hits, %lu minute hits, %lu misses; "
+                "want 86400, 84960, 1440\n",
+                settings,
+                (unsigned long)m.hits,
+                (unsigned long)m.minute_hits,
+                (unsigned long)m.misses);
+            fail = 1;
+        }
+        printf(
+            "settings %u%s%s%s: %lu hits, %lu minute hits, %lu misses\n",
+            settings,
+            settings & CLOCK_24H ? " 24h" : "",
+            settings & CLOCK_SECONDS ? " seconds" : "",
+            settings & CLOCK_FRUGAL ? " frugal" : "",
+            (unsigned long)m.hits,
+            (unsigned long)m.minute_hits,
+            (unsigned long)m.misses);
+    }
+
+    // Out of order, settings changing: the memo must never hand back a state
+    // from another second's or another setting's decode. Neighbouring seconds
+    // are asked for often, so the minute path is exercised too.
+    ClockModel m;
+    clock_model_init(&m);
+    uint32_t t = 0, prev = UINT32_MAX;
+    uint8_t settings = 0, prev_settings = 0;
+    uint32_t want[3] = {0, 0, 0}; // hits, minute hits, misses
+    for(int i = 0; i < SCRAMBLE; i++) {
+        if(rnd(4) == 0) settings = rnd(COMBOS);
+        t = rnd(3) ? (t + rnd(3)) % 86400 : rnd(86400);
+        const bool same = prev != UINT32_MAX && settings == prev_settings;
+        want[same && t == prev ? 0 : same && t / 60 == prev / 60 ? 1 : 2]++;
+        prev = t;
+        prev_settings = settings;
+
+        ClockModel fresh;
+        clock_model_init(&fresh);
+        const DisplayState* s = clock_model(&m, t, settings);
+        const Readout r = readout(s);
+        if(memcmp(s, clock_model(&fresh, t, settings), sizeof(*s)) || !check(&r, t, settings)) {
+            printf(
+                "FAIL: scrambled call %d: settings %u, second %lu\n",
+                i,
+                settings,
+                (unsigned long)t);
+            fail = 1;
+            break;
+        }
+    }
+    if(m.hits != want[0] || m.minute_hits != want[1] || m.misses != want[2]) {
+        printf(
+            "FAIL: scrambled counters, want %lu / %lu / %lu\n",
+            (unsigned long)want[0],
+            (unsigned long)want[1],
+            (unsigned long)want[2]);
+        fail = 1;
+    }
+    printf(
+        "scrambled: %lu hits, %lu minute hits, %lu misses\n",
+        (unsigned long)m.hits,
+        (unsigned long)m.minute_hits,
+        (unsigned long)m.misses);
+
+    printf("%s\n", fail ? "FAILED" : "ok");
+    return fail;
+}
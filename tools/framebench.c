@@ -0,0 +1,106 @@
+// Host benchmark for the inverted display: frame cost, normal vs inverted.
+//
+//   cc -O2 -I. -Itools/host tools/framebench.c frame.c analog.c -o framebench && ./framebench
+//
+// Replays the clock's three kinds of frame (a full redraw, a seconds-digits
+// update, a single seconds tick) into a Frame, the analog face's one (the
+// dial copied in and every hand drawn, each second), and the same
+// frames followed by the frame_invert pass that the inverted display adds
+// before the blit. The blit itself (canvas_draw_xbm) is the same in both and
+// isn't measured.
+
+#include "analog.h"
+#include "frame.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define ROUNDS 200000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// A "digit 8" box glyph of each size the landscape face uses.
+static uint8_t big[BITMAP_STRIDE(23) * 64];
+static uint8_t small[BITMAP_STRIDE(11) * 19];
+
+static void glyph(uint8_t* px, int w, int h, int t) {
+    bitmap_box(px, w, h, 0, 0, w, h, true);
+    bitmap_box(px, w, h, t, t, w - 2 * t, h / 2 - t - t / 2, false);
+    bitmap_box(px, w, h, t, h / 2 + t / 2, w - 2 * t, h - t - (h / 2 + t / 2), false);
+}
+
+static void full(Frame* f, int i) {
+    (void)i;
+    frame_clear(f);
+    for(int d = 0; d < 4; d++) frame_blit(f, 2 + d * 26 + (d > 1) * 10, 0, 23, 64, big);
+    frame_box(f, 54, 16, 6, 6, true);
+    frame_box(f, 54, 40, 6, 6, true);
+    frame_blit(f, 116, 0, 11, 19, small);
+    frame_blit(f, 116, 21, 11, 19, small);
+}
+
+static void seconds(Frame* f, int i) {
+    (void)i;
+    frame_blit(f, 116, 0, 11, 19, small);
+    frame_blit(f, 116, 21, 11, 19, small);
+}
+
+static void tick(Frame* f, int i) {
+    frame_box(f, 116 + (i % 6) * 2, (i / 6 % 10) * 4, 1, 3, true);
+}
+
+// The analog face: hands at a time that moves on a second per frame.
+static Frame dial;
+
+static void analog(Frame* f, int i) {
+    analog_draw(f, &dial, i / 720 % 60, i / 60 % 60, i % 60);
+}
+
+static double run(void (*draw)(Frame*, int), bool inverted) {
+    static Frame f;
+    static Frame out;
+    volatile uint32_t sink = 0;
+
+    memset(&f, 0, sizeof(f));
+    const double t0 = now_ns();
+    for(int i = 0; i < ROUNDS; i++) {
+        draw(&f, i);
+        if(inverted) {
+            frame_invert(&out, &f);
+            sink += out.words[i & 255];
+        } else {
+            sink += f.words[i & 255];
+        }
+    }
+    (void)sink;
+    return (now_ns() - t0) / ROUNDS;
+}
+
+int main(void) {
+    glyph(big, 23, 64, 7);
+    glyph(small, 11, 19, 2);
+    analog_dial(&dial);
+
+    static const struct {
+        const char* name;
+        void (*draw)(Frame*, int);
+    } frames[] = {
+        {"full redraw", full},
+        {"seconds digits", seconds},
+        {"seconds tick", tick},
+        {"analog", analog},
+    };
+
+    printf("frame            normal ns  inverted ns  invert pass ns\n");
+    for(size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++) {
+        const double normal = run(frames[i].draw, false);
+        const double inverted = run(frames[i].draw, true);
+        printf("%-15s  %9.1f  %11.1f  %14.1f\n", frames[i].name, normal, inverted, inverted - normal);
+    }
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Host benchmark for packed portrait glyphs: what an LRU of unpacked glyphs
+// would hit over a simulated day, and what drawing one costs without it.
+//
+//   cc -O2 -I. -Itools/host tools/glyphlru.c glyphs.c frame.c portraitdata.c -o glyphlru
+//   ./glyphlru
+//
+// Plays 24 hours of portrait clock, second by second, and draws a big digit
+// glyph the way portrait_face does: only for a digit that changed, and for all
+// four on a full redraw (coming back from another page, a wake, the settings
+// menu). Hit rates are given for a modelled LRU of 1..10 glyphs and a few
+// full-redraw rates. The app keeps no LRU and decodes each glyph straight
+// into the frame; that is timed against unpacking into a bitmap and blitting
+// it. Also checks every unpacked
+// glyph against glyphs.c's own digits.
+//
+// The app has no unpacked form, so unpack() here is the run decoder of
+// glyph_blit_packed writing into a bitmap of the glyph's own size.
+
+#include "frame.h"
+#include "glyphs.h"
+#include "portrait.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define DAY        86400
+#define MAX_SLOTS  10
+#define BIG_W      27   // logical (unrotated) size, as tools/portraitgen.py
+#define BIG_H      52
+#define BIG_T      6
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Unpack one run stream into dst (BITMAP_STRIDE(w) * h bytes).
+static void unpack(const uint8_t* runs, int w, int h, uint8_t* dst) {
+    int x = 0, y = 0;
+    bool on = false;
+    while(y < h) {
+        int n = *runs;
+        const bool more = (n == 255);
+        while(n > 0 && y < h) {
+            const int span = n < w - x ? n : w - x;
+            bitmap_box(dst, w, h, x, y, span, 1, on);
+            x += span;
+            n -= span;
+            if(x == w) {
+                x = 0;
+                y++;
+            }
+        }
+        runs++;
+        if(!more) on = !on;
+    }
+}
+
+static bool px(const uint8_t* bits, int w, int x, int y) {
+    return bits[y * BITMAP_STRIDE(w) + x / 8] >> (x % 8) & 1;
+}
+
+// Physical (x, y) of a rotated glyph is logical (BIG_W - 1 - y, x).
+static int check_glyphs(void) {
+    const PortraitSet* set = &portrait_big;
+    DigitSet ref;
+    digitset_init(&ref, BIG_W, BIG_H, BIG_T);
+    uint8_t got[BITMAP_STRIDE(BIG_H) * BIG_W];
+    int bad = 0;
+    for(int d = 0; d < 10; d++) {
+        unpack(&set->runs[set->offset[d]], set->w, set->h, got);
+        for(int y = 0; y < set->h; y++) {
+            for(int x = 0; x < set->w; x++) {
+                if(px(got, set->w, x, y) != px(digitset_glyph(&ref, d), BIG_W, BIG_W - 1 - y, x)) {
+                    bad++;
+                }
+            }
+        }
+    }
+    digitset_free(&ref);
+    return bad;
+}
+
+// The big digits at second s of the day, as readout_clock: 12 h blanks a
+// leading zero (-1).
+static void digits(int s, bool h24, int8_t out[4]) {
+    int h = s / 3600;
+    const int m = (s / 60) % 60;
+    if(!h24) h = (h % 12) ? h % 12 : 12;
+    out[0] = (h24 || h >= 10) ? h / 10 : -1;
+    out[1] = h % 10;
+    out[2] = m / 10;
+    out[3] = m % 10;
+}
+
+typedef struct {
+    int key[MAX_SLOTS];
+    uint32_t used[MAX_SLOTS];
+    uint32_t clock;
+    int slots;
+    uint32_t hits, misses;
+} Model;
+
+static void model_get(Model* m, int key) {
+    int oldest = 0;
+    m->clock++;
+    for(int i = 0; i < m->slots; i++) {
+        if(m->used[i] && m->key[i] == key) {
+            m->hits++;
+            m->used[i] = m->clock;
+            return;
+        }
+        if(m->used[i] < m->used[oldest]) oldest = i;
+    }
+    m->misses++;
+    m->key[oldest] = key;
+    m->used[oldest] = m->clock;
+}
+
+// One day; every `full` seconds (0 = never) a full redraw.
+static void day(Model* m, bool h24, int full) {
+    int8_t shown[4] = {-2, -2, -2, -2};   // -2: nothing drawn (start)
+    for(int s = 0; s < DAY; s++) {
+        int8_t d[4];
+        digits(s, h24, d);
+        const bool redraw = full && s % full == 0;
+        for(int i = 0; i < 4; i++) {
+            if(d[i] == shown[i] && !redraw) continue;
+            shown[i] = d[i];
+            if(d[i] < 0) continue;
+            model_get(m, d[i]);
+        }
+    }
+}
+
+int main(void) {
+    const int bad = check_glyphs();
+    if(bad) {
+        printf("unpacked glyphs differ from glyphs.c in %d pixels\n", bad);
+        return 1;
+    }
+
+    const int fulls[] = {0, 900, 300, 60};
+    const char* full_names[] = {"never", "15 min", "5 min", "1 min"};
+
+    printf("big digit draws per day (24 h) and LRU hit rate (12 h / 24 h),\n");
+    printf("by full-redraw interval\n");
+    printf("slots  bytes ");
+    for(int f = 0; f < 4; f++) printf(" %15s", full_names[f]);
+    printf("\n");
+    for(int slots = 1; slots <= MAX_SLOTS; slots++) {
+        printf("%5d %6d ", slots, slots * (int)portrait_big.size);
+        for(int f = 0; f < 4; f++) {
+            double rate[2];
+            uint32_t draws = 0;
+            for(int h24 = 0; h24 < 2; h24++) {
+                Model m = {.slots = slots};
+                day(&m, h24, fulls[f]);
+                rate[h24] = 100.0 * m.hits / (m.hits + m.misses);
+                draws = m.hits + m.misses;
+            }
+            printf(" %4lu %4.0f%%/%3.0f%%", (unsigned long)draws, rate[0], rate[1]);
+        }
+        printf("\n");
+    }
+
+    // Per glyph: decoded straight into the frame (the app), unpacked into a
+    // bitmap and blitted (an LRU miss), and a blit alone (an LRU hit).
+    const PortraitSet* set = &portrait_big;
+    const int rounds = 100000;
+    static Frame f;
+    uint8_t out[BITMAP_STRIDE(BIG_H) * BIG_W];
+    double t0 = now_ns();
+    for(int i = 0; i < rounds; i++) portrait_blit(&f, set, i % 10, 0, i % 37);
+    const double direct_ns = (now_ns() - t0) / rounds;
+    t0 = now_ns();
+    for(int i = 0; i < rounds; i++) {
+        unpack(&set->runs[set->offset[i % 10]], set->w, set->h, out);
+        frame_blit(&f, 0, i % 37, set->w, set->h, out);
+    }
+    const double unpack_ns = (now_ns() - t0) / rounds;
+    t0 = now_ns();
+    for(int i = 0; i < rounds; i++) frame_blit(&f, 0, i % 37, set->w, set->h, out);
+    const double blit_ns = (now_ns() - t0) / rounds;
+
+    // End of the last glyph's stream: where its runs cover w x h pixels.
+    uint32_t packed = set->offset[9];
+    for(int n = 0; n < set->w * set->h;) n += set->runs[packed++];
+    printf(
+        "\nbig set: %u bytes packed (+%u offsets), %u as bitmaps\n",
+        (unsigned)packed,
+        (unsigned)(10 * sizeof(uint16_t)),
+        (unsigned)(10 * set->size));
+    printf(
+        "per glyph: decoded into the frame %.0f ns, unpacked and blitted %.0f ns, "
+        "blit alone %.0f ns\n",
+        direct_ns,
+        unpack_ns,
+        blit_ns);
+    return 0;
+}
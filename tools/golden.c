@@ -0,0 +1,200 @@
+// Host golden-frame check: every face rendered at the screen size it is built
+// for, compared pixel for pixel with the reference bitmaps in tools/golden/.
+//
+//   SRC="tools/golden.c segface.c analog.c binary.c portraitface.c portraitdata.c"
+//   SRC="$SRC glyphs.c frame.c clockmodel.c"
+//   cc -O2 -I. -Itools/host $SRC -o golden && ./golden
+//   cc -O2 -I. -Itools/host -DFRAME_W=192 -DFRAME_H=96 $SRC -o golden && ./golden
+//
+// Run from the repo root. Each case is a clock time and settings, turned into
+// a Readout by the clock model as the app does, and drawn through the face's
+// ClockFace twice: once in full, and once as an update from the minute before
+// (only the damage on_tick reports). Both must equal the reference. Gutter
+// labels are canvas text, not frame pixels, so they aren't in the landscape
+// bitmaps; portrait draws them into the frame, so its bitmaps have them.
+//
+// Portrait (128x64 builds only) is drawn from the tables tools/portraitgen.py
+// rotates and packs. Its digit glyphs are also checked against glyphs.c:
+// each one, turned back upright, must equal what digitset_init rasterizes at
+// the same size and thickness.
+// References are plain PBM (P1), one text row per pixel row; `./golden -w`
+// rewrites them after an intended change. Look at the diff before committing.
+
+#include "analog.h"
+#include "binary.h"
+#include "clockmodel.h"
+#include "layout.h"
+#include "portrait.h"
+#include "portraitface.h"
+#include "segface.h"
+
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    const char* name;
+    const ClockFace* face;
+    uint32_t second;    // second of day
+    uint8_t settings;   // CLOCK_*
+} Case;
+
+static const Case cases[] = {
+    {"digital-seconds", &seg_face, 10 * 3600 + 8 * 60 + 42, CLOCK_SECONDS},
+    {"digital-grid", &seg_face, 23 * 3600 + 59 * 60 + 37, CLOCK_24H},
+    {"digital-frugal", &seg_face, 7 * 3600 + 30 * 60 + 5, CLOCK_SECONDS | CLOCK_FRUGAL},
+    {"analog", &analog_face, 10 * 3600 + 8 * 60 + 42, CLOCK_SECONDS},
+    {"analog-frugal", &analog_face, 16 * 3600 + 45 * 60, CLOCK_SECONDS | CLOCK_FRUGAL},
+    {"binary", &binary_face, 10 * 3600 + 8 * 60 + 42, CLOCK_SECONDS},
+    {"binary-hhmm", &binary_face, 23 * 3600 + 59 * 60 + 37, CLOCK_24H},
+#if LAYOUT_PORTRAIT
+    {"portrait-seconds", &portrait_face, 10 * 3600 + 8 * 60 + 42, CLOCK_SECONDS},
+    {"portrait-grid", &portrait_face, 23 * 3600 + 59 * 60 + 37, CLOCK_24H},
+    {"portrait-frugal", &portrait_face, 16 * 3600 + 45 * 60 + 5, CLOCK_SECONDS | CLOCK_FRUGAL},
+#endif
+};
+
+static int pixel(const Frame* f, int x, int y) {
+    return (f->px[y * FRAME_STRIDE + x / 8] >> (x % 8)) & 1;
+}
+
+static Readout readout(uint32_t second, uint8_t settings) {
+    ClockModel m;
+    clock_model_init(&m);
+    Readout r;
+    memset(&r, 0, sizeof(r));
+    display_readout(clock_model(&m, second % 86400, settings), &r);
+    r.minute_s = 60 - second % 60;
+    return r;
+}
+
+// Render c in full, or as an update from a minute earlier.
+static void render(const Case* c, bool update, Frame* f) {
+    void* face = c->face->init();
+    FaceRect damage[FACE_DAMAGE_MAX];
+    uint8_t next_s;
+    frame_clear(f);
+
+    Readout r = readout(c->second + (update ? 86400 - 60 : 0), c->settings);
+    int n = c->face->on_tick(face, &r, damage, &next_s);
+    for(int i = 0; i < n; i++) c->face->render(face, f, &damage[i]);
+    if(update) {
+        r = readout(c->second, c->settings);
+        n = c->face->on_tick(face, &r, damage, &next_s);
+        for(int i = 0; i < n; i++) c->face->render(face, f, &damage[i]);
+    }
+    c->face->deinit(face);
+}
+
+#if LAYOUT_PORTRAIT
+// Portrait digit glyphs against glyphs.c. A logical (upright) pixel (x, y)
+// sits at (y, lw - 1 - x) in the stored glyph, lw being the upright width.
+static int check_portrait_set(const char* name, const PortraitSet* set) {
+    const int lw = set->h, lh = set->w;
+    DigitSet upright;
+    digitset_init(&upright, lw, lh, set->t);
+    int fail = 0;
+    for(int d = 0; d < 10 && !fail; d++) {
+        static Frame stored; // drawn as the face draws it
+        frame_clear(&stored);
+        portrait_blit(&stored, set, d, 0, 0);
+        const uint8_t* want = digitset_glyph(&upright, d);
+        for(int y = 0; y < set->h; y++) {
+            for(int x = 0; x < set->w; x++) {
+                const int lx = lw - 1 - y, ly = x;
+                const int a = pixel(&stored, x, y);
+                const int b = (want[ly * BITMAP_STRIDE(lw) + lx / 8] >> (lx % 8)) & 1;
+                if(a != b) fail = 1;
+            }
+        }
+        if(fail) {
+            printf(
+                "FAIL: %s digit %d differs from glyphs.c (%dx%d, t %d)\n", name, d, lw, lh, set->t);
+        }
+    }
+    digitset_free(&upright);
+    if(!fail) printf("%s: 10 digits equal glyphs.c at %dx%d, t %d\n", name, lw, lh, set->t);
+    return fail;
+}
+#endif
+
+static bool write_pbm(const char* path, const Frame* f) {
+    FILE* out = fopen(path, "w");
+    if(!out) return false;
+    fprintf(out, "P1\n%d %d\n", FRAME_W, FRAME_H);
+    for(int y = 0; y < FRAME_H; y++) {
+        for(int x = 0; x < FRAME_W; x++) fputc('0' + pixel(f, x, y), out);
+        fputc('\n', out);
+    }
+    return fclose(out) == 0;
+}
+
+// Pixels of f that differ from the reference at path; -1 if it can't be read.
+static int compare_pbm(const char* path, const Frame* f) {
+    FILE* in = fopen(path, "r");
+    if(!in) return -1;
+    int w, h;
+    if(fscanf(in, "P1 %d %d", &w, &h) != 2 || w != FRAME_W || h != FRAME_H) {
+        fclose(in);
+        return -1;
+    }
+    int diff = 0;
+    for(int i = 0; i < FRAME_W * FRAME_H; i++) {
+        int ch;
+        do {
+            ch = fgetc(in);
+        } while(ch == ' ' || ch == '\n' || ch == '\r' || ch == '\t');
+        if(ch != '0' && ch != '1') {
+            fclose(in);
+            return -1;
+        }
+        diff += (ch - '0') != pixel(f, i % FRAME_W, i / FRAME_W);
+    }
+    fclose(in);
+    return diff;
+}
+
+int main(int argc, char** argv) {
+    const bool rewrite = argc > 1 && strcmp(argv[1], "-w") == 0;
+    int fail = 0;
+
+#if LAYOUT_PORTRAIT
+    fail |= check_portrait_set("portrait_big", &portrait_big);
+    fail |= check_portrait_set("portrait_small", &portrait_small);
+#endif
+
+    for(size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const Case* c = &cases[i];
+        char path[96];
+        snprintf(path, sizeof(path), "tools/golden/%s-%dx%d.pbm", c->name, FRAME_W, FRAME_H);
+
+        static Frame full, update;
+        render(c, false, &full);
+        render(c, true, &update);
+        if(memcmp(full.px, update.px, sizeof(full.px))) {
+            printf("FAIL: %s: the update from a minute before differs from a full render\n", path);
+            fail = 1;
+        }
+
+        if(rewrite) {
+            if(!write_pbm(path, &full)) {
+                printf("FAIL: %s: can't write\n", path);
+                fail = 1;
+            }
+            printf("wrote %s\n", path);
+            continue;
+        }
+        const int diff = compare_pbm(path, &full);
+        if(diff) {
+            if(diff < 0) {
+                printf("FAIL: %s: missing or not a %dx%d P1 file\n", path, FRAME_W, FRAME_H);
+            } else {
+                printf("FAIL: %s: %d pixels differ\n", path, diff);
+            }
+            fail = 1;
+        } else {
+            printf("%s ok\n", path);
+        }
+    }
+    printf("%s\n", fail ? "FAILED" : "ok");
+    return fail;
+}
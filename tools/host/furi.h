@@ -0,0 +1,30 @@
+// Just enough of furi.h to build the pure modules (frame.c, ...) on a host.
+#pragma once
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MIN(a, b)   ((a) < (b) ? (a) : (b))
+#define MAX(a, b)   ((a) > (b) ? (a) : (b))
+#define COUNT_OF(x) (sizeof(x) / sizeof((x)[0]))
+
+#define furi_assert(x) assert(x)
+#define furi_check(x)  assert(x)
+
+// Records and strings, for the modules that save through storage (alarms.c);
+// implemented in storage.c.
+#define APP_DATA_PATH(p) "/data/" p
+#define RECORD_STORAGE   "storage"
+
+typedef struct FuriString FuriString;
+
+void* furi_record_open(const char* name);
+void furi_record_close(const char* name);
+
+FuriString* furi_string_alloc_set(const char* s);
+const char* furi_string_get_cstr(const FuriString* s);
+void furi_string_free(FuriString* s);
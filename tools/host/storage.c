@@ -0,0 +1,108 @@
+// In-memory files and the furi bits storage needs, for the host tools.
+#include <storage/storage.h>
+
+#define HOST_FILES 8
+
+struct FuriString {
+    char* s;
+};
+
+typedef struct {
+    char path[64];
+    uint8_t* data;
+    size_t size;
+} HostFile;
+
+struct File {
+    HostFile* file;
+    size_t pos;
+};
+
+static HostFile files[HOST_FILES];
+
+void* furi_record_open(const char* name) {
+    (void)name;
+    return NULL;
+}
+
+void furi_record_close(const char* name) {
+    (void)name;
+}
+
+FuriString* furi_string_alloc_set(const char* s) {
+    FuriString* str = malloc(sizeof(FuriString));
+    str->s = strdup(s);
+    return str;
+}
+
+const char* furi_string_get_cstr(const FuriString* s) {
+    return s->s;
+}
+
+void furi_string_free(FuriString* s) {
+    free(s->s);
+    free(s);
+}
+
+static HostFile* find(const char* path, bool create) {
+    HostFile* free_slot = NULL;
+    for(int i = 0; i < HOST_FILES; i++) {
+        if(files[i].path[0] && !strcmp(files[i].path, path)) return &files[i];
+        if(!files[i].path[0] && !free_slot) free_slot = &files[i];
+    }
+    if(!create || !free_slot) return NULL;
+    strncpy(free_slot->path, path, sizeof(free_slot->path) - 1);
+    return free_slot;
+}
+
+uint8_t* host_file(const char* path, size_t* size) {
+    HostFile* hf = find(path, false);
+    if(!hf) return NULL;
+    *size = hf->size;
+    return hf->data;
+}
+
+File* storage_file_alloc(Storage* storage) {
+    (void)storage;
+    return calloc(1, sizeof(File));
+}
+
+void storage_file_free(File* f) {
+    free(f);
+}
+
+bool storage_file_open(File* f, const char* path, FS_AccessMode access, FS_OpenMode mode) {
+    (void)access;
+    f->file = find(path, mode == FSOM_CREATE_ALWAYS);
+    f->pos = 0;
+    if(f->file && mode == FSOM_CREATE_ALWAYS) f->file->size = 0;
+    return f->file != NULL;
+}
+
+bool storage_file_close(File* f) {
+    f->file = NULL;
+    return true;
+}
+
+size_t storage_file_read(File* f, void* buf, size_t size) {
+    const size_t n = MIN(size, f->file->size - f->pos);
+    memcpy(buf, f->file->data + f->pos, n);
+    f->pos += n;
+    return n;
+}
+
+size_t storage_file_write(File* f, const void* buf, size_t size) {
+    HostFile* hf = f->file;
+    if(f->pos + size > hf->size) {
+        hf->data = realloc(hf->data, f->pos + size);
+        hf->size = f->pos + size;
+    }
+    memcpy(hf->data + f->pos, buf, size);
+    f->pos += size;
+    return size;
+}
+
+void storage_common_resolve_path_and_ensure_app_directory(Storage* storage, FuriString* path) {
+    (void)storage;
+    (void)path;
+}
@@ -0,0 +1,29 @@
+// Just enough of storage.h for the host tools: files live in memory
+// (tools/host/storage.c), so a tool can save, corrupt and reload them.
+#pragma once
+
+#include <furi.h>
+
+typedef struct Storage Storage;
+typedef struct File File;
+
+typedef enum {
+    FSAM_READ = 1,
+    FSAM_WRITE = 2,
+} FS_AccessMode;
+
+typedef enum {
+    FSOM_OPEN_EXISTING = 1,
+    FSOM_CREATE_ALWAYS = 4,
+} FS_OpenMode;
+
+File* storage_file_alloc(Storage* storage);
+void storage_file_free(File* f);
+bool storage_file_open(File* f, const char* path, FS_AccessMode access, FS_OpenMode mode);
+bool storage_file_close(File* f);
+size_t storage_file_read(File* f, void* buf, size_t size);
+size_t storage_file_write(File* f, const void* buf, size_t size);
+void storage_common_resolve_path_and_ensure_app_directory(Storage* storage, FuriString* path);
+
+// Host only: the bytes held under `path` (NULL if none), and their size.
+uint8_t* host_file(const char* path, size_t* size);
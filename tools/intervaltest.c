@@ -0,0 +1,155 @@
+// Host check for the interval timer (interval.c): a run rebuilt from its
+// saved record agrees with one that was polled all along.
+//
+//   cc -O2 -I. tools/intervaltest.c interval.c -o intervaltest && ./intervaltest
+//
+// For every cycle count 1..16 (and a few work/rest lengths), starts a run and
+// saves its record, then steps it second by second with interval_poll. At
+// every second interval_restore from that same record, as a relaunch would,
+// must land on the same phase, state and seconds left, without stepping. A
+// paused run must restore paused, with the same time left, however much
+// later, and resume from there. Also times interval_restore deep into a run.
+
+#include "interval.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define T0     1790000000UL // an RTC timestamp (2026)
+#define ROUNDS 1000000
+
+// Work and rest seconds tried with each cycle count.
+static const uint16_t lengths[][2] = {
+    {25 * 60, 5 * 60},
+    {60, 60},
+    {50 * 60, 10 * 60},
+    {99 * 60, 60},
+};
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static bool same(const Interval* a, const Interval* b, uint32_t now) {
+    return a->phase == b->phase && a->state == b->state &&
+           interval_left(a, now) == interval_left(b, now);
+}
+
+// Poll one run to the end, restoring at every second. Returns seconds checked.
+static uint32_t check_run(uint16_t work_s, uint16_t rest_s, uint8_t cycles, int* fail) {
+    Interval polled, restored;
+    interval_init(&polled, work_s, rest_s, cycles);
+    interval_start(&polled, T0);
+    IntervalRecord rec;
+    interval_save(&polled, &rec);
+
+    const uint32_t total = cycles * work_s + (cycles - 1) * rest_s;
+    uint32_t changes = 0;
+    for(uint32_t t = T0; t <= T0 + total + 5; t++) {
+        if(interval_poll(&polled, t)) changes++;
+        if(!interval_restore(&restored, &rec, t) || !same(&polled, &restored, t)) {
+            printf(
+                "FAIL: %u x %u/%u s at +%lu s: polled phase %u state %u, restored %u/%u\n",
+                cycles,
+                work_s,
+                rest_s,
+                (unsigned long)(t - T0),
+                polled.phase,
+                polled.state,
+                restored.phase,
+                restored.state);
+            *fail = 1;
+            return t - T0;
+        }
+    }
+    if(polled.state != IntervalDone || changes != polled.phases) {
+        printf(
+            "FAIL: %u cycles: %lu phase changes, want %u\n",
+            cycles,
+            (unsigned long)changes,
+            polled.phases);
+        *fail = 1;
+    }
+    return total + 6;
+}
+
+// Pause at every tenth second, restore much later, resume: the time left and
+// the phase carry over.
+static void check_paused(uint8_t cycles, int* fail) {
+    const uint16_t work_s = 120, rest_s = 60;
+    const uint32_t total = cycles * work_s + (cycles - 1) * rest_s;
+    for(uint32_t at = 0; at < total; at += 10) {
+        Interval a, b;
+        interval_init(&a, work_s, rest_s, cycles);
+        interval_start(&a, T0);
+        interval_pause(&a, T0 + at);
+        IntervalRecord rec;
+        interval_save(&a, &rec);
+
+        const uint32_t later = T0 + 7 * 86400 + at;
+        const uint32_t left = interval_left(&a, T0 + at);
+        if(!interval_restore(&b, &rec, later) || b.state != IntervalPaused ||
+           b.phase != a.phase || interval_left(&b, later) != left) {
+            printf("FAIL: %u cycles paused at +%lu s didn't restore\n", cycles, (unsigned long)at);
+            *fail = 1;
+            return;
+        }
+        interval_start(&b, later);
+        interval_poll(&b, later + left - 1);
+        const uint8_t phase = b.phase;
+        interval_poll(&b, later + left);
+        if(phase != a.phase || b.phase != a.phase + 1) {
+            printf(
+                "FAIL: %u cycles resumed at +%lu s: phase %u\n",
+                cycles,
+                (unsigned long)at,
+                b.phase);
+            *fail = 1;
+            return;
+        }
+    }
+}
+
+int main(void) {
+    int fail = 0;
+    uint64_t seconds = 0;
+    for(uint8_t cycles = 1; cycles <= INTERVAL_CYCLES_MAX; cycles++) {
+        for(size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+            seconds += check_run(lengths[i][0], lengths[i][1], cycles, &fail);
+        }
+        check_paused(cycles, &fail);
+    }
+
+    // Restoring late in the longest run costs what restoring early does.
+    Interval iv;
+    interval_init(&iv, 25 * 60, 5 * 60, INTERVAL_CYCLES_MAX);
+    interval_start(&iv, T0);
+    IntervalRecord rec;
+    interval_save(&iv, &rec);
+    volatile uint32_t sink = 0;
+    double best[2] = {1e18, 1e18};
+    for(int r = 0; r < 5; r++) {
+        for(int late = 0; late < 2; late++) {
+            const uint32_t now = T0 + (late ? 15 * 3600 : 60);
+            const double t0 = now_ns();
+            for(int i = 0; i < ROUNDS; i++) {
+                interval_restore(&iv, &rec, now);
+                sink += iv.phase;
+            }
+            const double t = (now_ns() - t0) / ROUNDS;
+            if(t < best[late]) best[late] = t;
+        }
+    }
+
+    printf(
+        "1..%d cycles, %llu seconds restored and compared with polling; "
+        "restore %.0f ns at +1 min, %.0f ns at +15 h\n",
+        INTERVAL_CYCLES_MAX,
+        (unsigned long long)seconds,
+        best[0],
+        best[1]);
+    printf("%s\n", fail ? "FAILED" : "ok");
+    return fail;
+}
@@ -0,0 +1,121 @@
+// Host check and benchmark for the stopwatch lap history (laps.c).
+//
+//   cc -O2 -I. tools/lapbench.c laps.c -o lapbench && ./lapbench
+//
+// Takes 10,000 laps and times them a thousand at a time: with best, average
+// and last kept running, the last thousand cost what the first did even
+// though the ring wrapped long ago. Checks those three against a brute-force
+// pass over every lap, then exports and checks the CSV arrives in exactly
+// one write holding the newest LAPS_MAX laps.
+
+#include "laps.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LAPS   10000
+#define CHUNK  1000
+#define ROUNDS 200
+#define HZ     1000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t lap_ticks[LAPS];
+static Laps laps;
+
+typedef struct {
+    int calls;
+    size_t bytes;
+    char* data;
+} Sink;
+
+static size_t sink_write(void* ctx, const void* data, size_t size) {
+    Sink* s = ctx;
+    s->calls++;
+    s->data = realloc(s->data, s->bytes + size + 1);
+    memcpy(s->data + s->bytes, data, size);
+    s->bytes += size;
+    s->data[s->bytes] = '\0';
+    return size;
+}
+
+int main(void) {
+    // Laps of 40..80 s, in ticks, from a fixed LCG.
+    uint32_t seed = 12345;
+    for(int i = 0; i < LAPS; i++) {
+        seed = seed * 1103515245 + 12345;
+        lap_ticks[i] = 40000 + (seed >> 8) % 40000;
+    }
+
+    // Best of ROUNDS for each chunk of laps, so scheduling noise drops out.
+    double chunk_ns[LAPS / CHUNK];
+    for(int c = 0; c < LAPS / CHUNK; c++) chunk_ns[c] = 1e18;
+    for(int r = 0; r < ROUNDS; r++) {
+        laps_reset(&laps);
+        for(int c = 0; c < LAPS / CHUNK; c++) {
+            const double t0 = now_ns();
+            for(int i = c * CHUNK; i < (c + 1) * CHUNK; i++) laps_add(&laps, lap_ticks[i]);
+            const double ns = (now_ns() - t0) / CHUNK;
+            if(ns < chunk_ns[c]) chunk_ns[c] = ns;
+        }
+    }
+    printf("ns per lap, by thousand:");
+    for(int c = 0; c < LAPS / CHUNK; c++) printf(" %.1f", chunk_ns[c]);
+    printf("\n");
+
+    int fail = 0;
+    const double first = chunk_ns[0], last = chunk_ns[LAPS / CHUNK - 1];
+    if(last > 2 * first + 1) {
+        printf("FAIL: per-lap cost grows (%.1f -> %.1f ns)\n", first, last);
+        fail = 1;
+    }
+
+    // Running stats against brute force.
+    uint64_t total = 0;
+    uint32_t best = UINT32_MAX, best_lap = 0;
+    for(int i = 0; i < LAPS; i++) {
+        total += lap_ticks[i];
+        if(lap_ticks[i] < best) {
+            best = lap_ticks[i];
+            best_lap = i + 1;
+        }
+    }
+    if(laps.count != LAPS || laps.best != best || laps.best_lap != best_lap ||
+       laps_avg(&laps) != total / LAPS || laps.last != lap_ticks[LAPS - 1]) {
+        printf("FAIL: best/average/last differ from brute force\n");
+        fail = 1;
+    }
+
+    // Export: one write, header + LAPS_MAX laps + summary.
+    Sink sink = {0};
+    const double t0 = now_ns();
+    const bool ok = laps_csv(&laps, HZ, sink_write, &sink);
+    const double export_us = (now_ns() - t0) / 1000;
+    int lines = 0;
+    for(size_t i = 0; i < sink.bytes; i++) lines += sink.data[i] == '\n';
+    unsigned long n = 0;
+    sscanf(strchr(sink.data, '\n') + 1, "%lu,", &n);
+    if(!ok || sink.calls != 1 || lines != LAPS_MAX + 2 || n != LAPS - LAPS_MAX + 1) {
+        printf(
+            "FAIL: export took %d writes, %d lines, first lap %lu\n", sink.calls, lines, n);
+        fail = 1;
+    }
+    printf(
+        "export: %d write of %zu bytes (%d laps held of %d), %.0f us\n",
+        sink.calls,
+        sink.bytes,
+        LAPS_MAX,
+        LAPS,
+        export_us);
+    printf("%s", strrchr(sink.data, '#'));
+
+    free(sink.data);
+    printf("%s\n", fail ? "FAILED" : "ok");
+    return fail;
+}
@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+"""Pre-rotate the portrait glyphs and layout into portraitdata.c.
+
+Usage: python3 tools/portraitgen.py portraitdata.c
+
+Portrait is laid out on a 64x128 logical screen (the Flipper turned a
+quarter clockwise, screen's left edge up) and drawn into the normal 128x64
+frame. Everything is rotated here, once: the glyphs are stored already
+turned, and every position in the layout is a physical frame position, so
+the app draws portrait with the same blits and boxes as landscape.
+
+Digits are rasterized exactly like glyphs.c (segdigit); labels use a 3x5
+font. A glyph table is stored packed into pixel runs (glyphs.h) when that is
+smaller than its bitmaps. The script checks that each rotated glyph turns
+back into its logical raster, that each packed glyph unpacks to its bitmap,
+and that the layout stays on screen without overlaps.
+"""
+
+import sys
+
+# Logical (portrait) screen.
+LW, LH = 64, 128
+
+# Geometry, logical coordinates.
+BIG = (27, 52, 6)         # w, h, t
+SMALL = (9, 13, 2)
+DIGIT = [(3, 0), (34, 0), (3, 60), (34, 60)]   # H0 H1 M0 M1
+COLON = [(20, 54, 4, 4), (40, 54, 4, 4)]
+SMALL_AT = [(3, 114), (14, 114)]               # tens, units
+GRID = (3, 115, 20, 3, 1, 3, 1)                # x, y, cols, rows, tick w, tick h, gap
+FONT_W, FONT_H = 3, 5
+LABEL = [(46, 115), (46, 122), (55, 122)]      # slot origins, two characters each
+
+SEGMAP = [0b0111111, 0b0000110, 0b1011011, 0b1001111, 0b1100110,
+          0b1101101, 0b1111101, 0b0000111, 0b1111111, 0b1101111]
+
+# 3x5 label font, rows top-down.
+FONT = {
+    "!": ".#. .#. .#. ... .#.",
+    "0": "### #.# #.# #.# ###",
+    "1": ".#. ##. .#. .#. ###",
+    "2": "##. ..# .#. #.. ###",
+    "3": "##. ..# .#. ..# ##.",
+    "4": "#.# #.# ### ..# ..#",
+    "5": "### #.. ##. ..# ##.",
+    "6": ".## #.. ### #.# ###",
+    "7": "### ..# .#. .#. .#.",
+    "8": "### #.# ### #.# ###",
+    "9": "### #.# ### ..# ##.",
+    "A": ".#. #.# ### #.# #.#",
+    "B": "##. #.# ##. #.# ##.",
+    "C": ".## #.. #.. #.. .##",
+    "D": "##. #.# #.# #.# ##.",
+    "E": "### #.. ##. #.. ###",
+    "F": "### #.. ##. #.. #..",
+    "G": ".## #.. #.# #.# .##",
+    "H": "#.# #.# ### #.# #.#",
+    "I": "### .#. .#. .#. ###",
+    "J": "..# ..# ..# #.# .#.",
+    "K": "#.# #.# ##. #.# #.#",
+    "L": "#.. #.. #.. #.. ###",
+    "M": "#.# ### ### #.# #.#",
+    "N": "##. #.# #.# #.# #.#",
+    "O": ".#. #.# #.# #.# .#.",
+    "P": "##. #.# ##. #.. #..",
+    "Q": ".#. #.# #.# ##. .##",
+    "R": "##. #.# ##. #.# #.#",
+    "S": ".## #.. .#. ..# ##.",
+    "T": "### .#. .#. .#. .#.",
+    "U": "#.# #.# #.# #.# ###",
+    "V": "#.# #.# #.# #.# .#.",
+    "W": "#.# #.# ### ### #.#",
+    "X": "#.# #.# .#. #.# #.#",
+    "Y": "#.# #.# .#. .#. .#.",
+    "Z": "### ..# .#. #.. ###",
+    "|": ".#. .#. .#. .#. .#.",
+}
+
+
+def segdigit(w, h, t, d):
+    """Set of lit (x, y) for digit d, as glyphs.c draws it."""
+    px = set()
+
+    def box(x, y, bw, bh):
+        for yy in range(max(y, 0), min(y + bh, h)):
+            for xx in range(max(x, 0), min(x + bw, w)):
+                px.add((xx, yy))
+
+    m, ym, half = SEGMAP[d], h // 2, h // 2
+    if m & 1 << 0: box(0, 0, w, t)
+    if m & 1 << 6: box(0, ym - t // 2, w, t)
+    if m & 1 << 3: box(0, h - t, w, t)
+    if m & 1 << 5: box(0, 0, t, half)
+    if m & 1 << 1: box(w - t, 0, t, half)
+    if m & 1 << 4: box(0, h - half, t, half)
+    if m & 1 << 2: box(w - t, h - half, t, half)
+    return px
+
+
+def font_glyph(c):
+    rows = FONT[c].split()
+    return {(x, y) for y, row in enumerate(rows) for x, ch in enumerate(row) if ch == "#"}
+
+
+def rotate(px, w):
+    """Logical glyph pixels (w wide) -> physical pixels: (x, y) -> (y, w - 1 - x)."""
+    return {(y, w - 1 - x) for x, y in px}
+
+
+def unrotate(px, w):
+    return {(w - 1 - y, x) for x, y in px}
+
+
+def at(lx, ly, lw):
+    """Physical top-left of a logical lw-wide rectangle at (lx, ly)."""
+    return ly, LW - lx - lw
+
+
+def rect(lx, ly, lw, lh):
+    x, y = at(lx, ly, lw)
+    return x, y, lh, lw
+
+
+def xbm(px, w, h):
+    stride = (w + 7) // 8
+    out = bytearray(stride * h)
+    for x, y in px:
+        out[y * stride + x // 8] |= 1 << (x % 8)
+    return out
+
+
+def pack(px, w, h):
+    """Pixel runs in raster order, alternating clear/set from clear; 255 = continued."""
+    out = bytearray()
+    on, n = False, 0
+    for y in range(h):
+        for x in range(w):
+            if ((x, y) in px) == on:
+                n += 1
+                continue
+            out += bytes([255] * (n // 255) + [n % 255])
+            on, n = not on, 1
+    out += bytes([255] * (n // 255) + [n % 255])
+    return out
+
+
+def unpack(runs, w, h):
+    px, i, on, pos = set(), 0, False, 0
+    while pos < w * h:
+        n = runs[i]
+        for p in range(pos, min(pos + n, w * h)):
+            if on:
+                px.add((p % w, p // w))
+        pos += n
+        i += 1
+        if n != 255:
+            on = not on
+    return px
+
+
+def build_set(glyphs, lw, lh, t=0):
+    """Rotate a list of logical glyphs into one physical table.
+
+    Returns (pw, ph, t, size, bitmaps, runs): runs is a list of per-glyph run
+    streams when packing is smaller than the bitmaps, else None. t is the
+    segment thickness of digit sets (0 for the font).
+    """
+    pw, ph = lh, lw
+    data = bytearray()
+    runs = []
+    for g in glyphs:
+        r = rotate(g, lw)
+        if unrotate(r, lw) != g or any(not (0 <= x < pw and 0 <= y < ph) for x, y in r):
+            sys.exit("rotation check failed")
+        data += xbm(r, pw, ph)
+        runs.append(pack(r, pw, ph))
+        if unpack(runs[-1], pw, ph) != r:
+            sys.exit("packing check failed")
+    size = len(data) // len(glyphs)
+    packed = sum(len(x) for x in runs) + 2 * len(runs)   # uint16_t offsets
+    return pw, ph, t, size, data, runs if packed < len(data) else None
+
+
+def set_bytes(s):
+    runs = s[5]
+    return len(s[4]) if runs is None else sum(len(x) for x in runs) + 2 * len(runs)
+
+
+def check_layout():
+    rects = [(x, y, BIG[0], BIG[1]) for x, y in DIGIT]
+    rects += COLON
+    rects += [(x, y, SMALL[0], SMALL[1]) for x, y in SMALL_AT]
+    gx, gy, cols, rows, tw, th, gap = GRID
+    grid = (gx, gy, cols * (tw + gap) - gap, rows * (th + gap) - gap)
+    labels = [(x, y, 2 * (FONT_W + 1) - 1, FONT_H) for x, y in LABEL]
+    for x, y, w, h in rects + [grid] + labels:
+        if x < 0 or y < 0 or x + w > LW or y + h > LH:
+            sys.exit(f"({x}, {y}, {w}, {h}) is off the {LW}x{LH} screen")
+
+    # The grid and the small digits share the gutter (one or the other is shown).
+    def overlap(a, b):
+        return a[0] < b[0] + b[2] and b[0] < a[0] + a[2] and a[1] < b[1] + b[3] and b[1] < a[1] + a[3]
+
+    fixed = [(x, y, BIG[0], BIG[1]) for x, y in DIGIT] + COLON + labels
+    for gutter in ([grid], [(x, y, SMALL[0], SMALL[1]) for x, y in SMALL_AT]):
+        everything = fixed + gutter
+        for i, a in enumerate(everything):
+            for b in everything[i + 1 :]:
+                if overlap(a, b):
+                    sys.exit(f"{a} overlaps {b}")
+    return grid
+
+
+def write_bytes(w, decl, data):
+    w(f"{decl}[] = {{\n")
+    for i in range(0, len(data), 16):
+        w("    " + " ".join(f"0x{b:02x}," for b in data[i : i + 16]) + "\n")
+    w("};\n\n")
+
+
+def write_set(w, name, s):
+    pw, ph, t, size, data, runs = s
+    if runs is None:
+        write_bytes(w, f"static const uint8_t {name}_bits", data)
+        w(f"const PortraitSet {name} = {{{pw}, {ph}, {t}, {size}, {name}_bits, NULL, NULL}};\n\n")
+        return
+    offsets = [sum(len(x) for x in runs[:i]) for i in range(len(runs))]
+    write_bytes(w, f"static const uint8_t {name}_runs", b"".join(runs))
+    w(f"static const uint16_t {name}_offset[] = {{" + ", ".join(map(str, offsets)) + "};\n\n")
+    tables = f"NULL, {name}_runs, {name}_offset"
+    w(f"const PortraitSet {name} = {{{pw}, {ph}, {t}, {size}, {tables}}};\n\n")
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__.strip().splitlines()[2])
+
+    grid = check_layout()
+    chars = "".join(sorted(FONT))
+    big = build_set([segdigit(*BIG, d) for d in range(10)], *BIG)
+    small = build_set([segdigit(*SMALL, d) for d in range(10)], *SMALL)
+    font = build_set([font_glyph(c) for c in chars], FONT_W, FONT_H)
+
+    gx, gy, cols, rows, tw, th, gap = GRID
+    ticks = [at(gx + (i % cols) * (tw + gap), gy + (i // cols) * (th + gap), tw) for i in range(60)]
+    pair = lambda p: f"{{{p[0]}, {p[1]}}}"
+    quad = lambda r: f"{{{r[0]}, {r[1]}, {r[2]}, {r[3]}}}"
+
+    with open(sys.argv[1], "w") as f:
+        w = f.write
+        w("// Generated by tools/portraitgen.py. Do not edit; change the script and regenerate.\n\n")
+        w('#include "portrait.h"\n\n')
+        w("#include <stddef.h>\n\n")
+        write_set(w, "portrait_big", big)
+        write_set(w, "portrait_small", small)
+        write_set(w, "portrait_font", font)
+        w(f'const char portrait_chars[] = "{chars}";\n\n')
+        w("const PortraitLayout portrait_layout = {\n")
+        w("    .digit = {" + ", ".join(pair(at(x, y, BIG[0])) for x, y in DIGIT) + "},\n")
+        w("    .small = {" + ", ".join(pair(at(x, y, SMALL[0])) for x, y in SMALL_AT) + "},\n")
+        w("    .colon = {" + ", ".join(quad(rect(*c)) for c in COLON) + "},\n")
+        w(f"    .grid = {quad(rect(*grid))},\n")
+        w(f"    .tick_w = {th},\n")
+        w(f"    .tick_h = {tw},\n")
+        w("    .tick = {\n")
+        for i in range(0, 60, 10):
+            w("        " + " ".join(pair(t) + "," for t in ticks[i : i + 10]) + "\n")
+        w("    },\n")
+        w("    .label = {\n")
+        for x, y in LABEL:
+            slot = [at(x + i * (FONT_W + 1), y, FONT_W) for i in range(2)]
+            w("        {" + ", ".join(pair(p) for p in slot) + "},\n")
+        w("    },\n")
+        w("};\n")
+
+    sets = (big, small, font)
+    raw = sum(len(s[4]) for s in sets)
+    print(f"{sys.argv[1]}: {sum(map(set_bytes, sets))} bytes of glyphs ({raw} as bitmaps)", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
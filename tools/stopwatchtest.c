@@ -0,0 +1,97 @@
+// Host check for the stopwatch (stopwatch.c): recorded times don't depend on
+// how long a key event waited in the queue.
+//
+//   cc -O2 -I. tools/stopwatchtest.c stopwatch.c -o stopwatchtest && ./stopwatchtest
+//
+// Plays runs of start / lap / stop presses. Each press is stamped with the
+// tick it happened at, as input_cb does, and handled some ticks later (the
+// main loop busy with a redraw, a save, other events). Every lap and the
+// final elapsed time must equal the time between the stamps, whatever the
+// delays, across the tick counter wrapping too. The same runs charged at
+// the handling tick instead show the error the stamps avoid.
+
+#include "stopwatch.h"
+
+#include <stdio.h>
+
+#define RUNS      2000
+#define PRESSES   40    // per run: start, laps, stop
+#define MAX_DELAY 400   // ticks an event may wait in the queue
+#define HZ        1000
+
+static uint32_t seed = 12345;
+
+static uint32_t rnd(uint32_t n) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8) % n;
+}
+
+// |a - b| for tick counts that may straddle the wrap.
+static uint32_t diff(uint32_t a, uint32_t b) {
+    const int32_t d = (int32_t)(a - b);
+    return d < 0 ? (uint32_t)-d : (uint32_t)d;
+}
+
+int main(void) {
+    int fail = 0;
+    uint32_t worst_handled = 0;
+    uint64_t laps_checked = 0;
+
+    for(int run = 0; run < RUNS; run++) {
+        // Every eighth run starts just before the tick counter wraps.
+        uint32_t t = (run % 8 == 0) ? UINT32_MAX - rnd(60 * HZ) : rnd(1000000);
+        uint32_t stamp[PRESSES], handled[PRESSES];
+        for(int i = 0; i < PRESSES; i++) {
+            t += 1 + rnd(30 * HZ);
+            stamp[i] = t;
+            handled[i] = t + rnd(MAX_DELAY);
+        }
+
+        Stopwatch sw, late;
+        stopwatch_reset(&sw);
+        stopwatch_reset(&late);
+        for(int i = 0; i < PRESSES; i++) {
+            const bool toggle = (i == 0 || i == PRESSES - 1);
+            if(toggle) {
+                stopwatch_toggle(&sw, stamp[i]);
+                stopwatch_toggle(&late, handled[i]);
+            } else {
+                stopwatch_lap(&sw, stamp[i]);
+                stopwatch_lap(&late, handled[i]);
+                laps_checked++;
+                if(sw.last_lap != stamp[i] - stamp[i - 1]) {
+                    printf(
+                        "FAIL: run %d lap %d: %lu ticks, pressed %lu apart\n",
+                        run,
+                        i,
+                        (unsigned long)sw.last_lap,
+                        (unsigned long)(stamp[i] - stamp[i - 1]));
+                    fail = 1;
+                }
+                const uint32_t off = diff(late.last_lap, stamp[i] - stamp[i - 1]);
+                if(off > worst_handled) worst_handled = off;
+            }
+        }
+
+        // Stopped: elapsed is start to stop, read at any later tick.
+        const uint32_t want = stamp[PRESSES - 1] - stamp[0];
+        if(stopwatch_elapsed(&sw, t + rnd(HZ)) != want || sw.laps != PRESSES - 2) {
+            printf(
+                "FAIL: run %d: elapsed %lu, want %lu\n",
+                run,
+                (unsigned long)stopwatch_elapsed(&sw, t),
+                (unsigned long)want);
+            fail = 1;
+        }
+    }
+
+    printf(
+        "%d runs, %llu laps, queue delays up to %d ticks: stamped times exact; "
+        "charged when handled, laps off by up to %lu ticks\n",
+        RUNS,
+        (unsigned long long)laps_checked,
+        MAX_DELAY,
+        (unsigned long)worst_handled);
+    printf("%s\n", fail ? "FAILED" : "ok");
+    return fail;
+}
@@ -0,0 +1,72 @@
+// Host benchmark for the world clock: per-minute cost against the number of
+// zones shown.
+//
+//   cc -O2 -I. tools/tzbench.c tz.c tzdata.c -o tzbench && ./tzbench
+//
+// Replays one year of minute ticks for 1..32 zones through world_tick, and
+// the same year with a table search per zone per minute for comparison. The
+// RTC is taken to follow London time, DST changes included.
+
+#include "tz.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define YEAR_START 1767225600UL // 2026-01-01 00:00 UTC
+#define MINUTES    (365 * 24 * 60)
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// zones.txt for n zones: home London, then the table round-robin (skipping UTC).
+static void make_config(char* buf, size_t size, int n) {
+    size_t len = (size_t)snprintf(buf, size, "London\n");
+    for(int i = 0; i < n; i++) {
+        const int z = 1 + i % (tz_zone_count - 1);
+        len += (size_t)snprintf(buf + len, size - len, "%s\n", tz_zones[z].name);
+    }
+}
+
+int main(void) {
+    static char config[1024];
+    static uint32_t local[MINUTES];
+    volatile uint32_t sink = 0;
+
+    const int home = tz_find("London");
+    for(uint32_t m = 0; m < MINUTES; m++) {
+        const uint32_t utc = YEAR_START + m * 60;
+        local[m] = utc + (uint32_t)tz_offset(home, utc, NULL, NULL);
+    }
+
+    printf("zones  world_tick ns/min  lookups/year  per-minute search ns/min\n");
+
+    for(int n = 1; n <= WORLD_MAX; n *= 2) {
+        WorldClock wc;
+        make_config(config, sizeof(config), n);
+        world_config(&wc, config);
+
+        // Cached: world_tick each minute, then read every zone's time.
+        double t0 = now_ns();
+        for(uint32_t m = 0; m < MINUTES; m++) {
+            world_tick(&wc, local[m]);
+            sink += world_time(&wc, m % wc.count, local[m]);
+        }
+        const double cached = (now_ns() - t0) / MINUTES;
+
+        // Naive: search the table for every zone every minute.
+        t0 = now_ns();
+        for(uint32_t m = 0; m < MINUTES; m++) {
+            const uint32_t utc = YEAR_START + m * 60;
+            for(int i = 0; i < wc.count; i++) sink += (uint32_t)tz_offset(wc.zone[i], utc, NULL, NULL);
+        }
+        const double naive = (now_ns() - t0) / MINUTES;
+
+        printf("%5d  %17.1f  %12lu  %24.1f\n", n, cached, (unsigned long)wc.lookups, naive);
+    }
+
+    (void)sink;
+    return 0;
+}
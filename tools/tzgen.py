@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""Expand the rules in zones.def into the transition table in tzdata.c.
+
+Usage: python3 tools/tzgen.py [--first YEAR] [--last YEAR] tools/zones.def tzdata.c
+
+Every DST zone gets two transitions per year in [first, last]: the UTC instant
+of the change and the offset in force from then on. Offsets are stored in
+15-minute units (int8), instants as u32 UTC seconds. After the last
+transition a zone simply keeps its last offset, so regenerate with a later
+--last before the table runs out.
+"""
+
+import argparse
+import calendar
+import datetime
+import re
+import sys
+
+MONTHS = {m: i for i, m in enumerate(calendar.month_abbr) if m}
+DAYS = {d: i for i, d in enumerate(calendar.day_abbr)}
+
+
+def parse_offset(s):
+    m = re.fullmatch(r"([+-])(\d{1,2}):(\d\d)", s)
+    if not m:
+        raise ValueError(f"bad offset {s!r}")
+    minutes = int(m.group(2)) * 60 + int(m.group(3))
+    if minutes % 15:
+        raise ValueError(f"offset {s!r} is not a multiple of 15 minutes")
+    return (-minutes if m.group(1) == "-" else minutes) * 60
+
+
+def parse_time(s):
+    utc = s.endswith("u")
+    h, m = s.rstrip("u").split(":")
+    return int(h) * 3600 + int(m) * 60, utc
+
+
+def rule_day(year, month, spec):
+    """Day of month for 'lastSun' or 'Sun>=8' style specs."""
+    m = re.fullmatch(r"last(\w{3})", spec)
+    if m:
+        wd = DAYS[m.group(1)]
+        last = calendar.monthrange(year, month)[1]
+        return last - (datetime.date(year, month, last).weekday() - wd) % 7
+    m = re.fullmatch(r"(\w{3})>=(\d+)", spec)
+    if m:
+        wd = DAYS[m.group(1)]
+        lo = int(m.group(2))
+        return lo + (wd - datetime.date(year, month, lo).weekday()) % 7
+    raise ValueError(f"bad day {spec!r}")
+
+
+def instant(year, rule, before):
+    """UTC instant of a rule in a year. before = offset in force until then."""
+    month, spec, time = rule
+    seconds, utc = parse_time(time)
+    day = rule_day(year, MONTHS[month], spec)
+    midnight = calendar.timegm((year, MONTHS[month], day, 0, 0, 0))
+    return midnight + seconds - (0 if utc else before)
+
+
+def parse(path):
+    zones = []
+    for lineno, line in enumerate(open(path), 1):
+        line = line.split("#", 1)[0].split()
+        if not line:
+            continue
+        try:
+            if len(line) == 3:
+                name, tag, std = line
+                zones.append((name, tag, parse_offset(std), None))
+            elif len(line) == 10:
+                name, tag, std, dst = line[:4]
+                start, end = tuple(line[4:7]), tuple(line[7:10])
+                zones.append((name, tag, parse_offset(std), (parse_offset(dst), start, end)))
+            else:
+                raise ValueError("expected 3 or 10 fields")
+            if len(tag) != 2:
+                raise ValueError(f"tag {tag!r} must be two characters")
+        except (ValueError, KeyError) as e:
+            sys.exit(f"{path}:{lineno}: {e}")
+    return zones
+
+
+def transitions(zone, first, last):
+    _, _, std, rule = zone
+    if rule is None:
+        return std, []
+    dst, start, end = rule
+    out = []
+    for year in range(first, last + 1):
+        out.append((instant(year, start, std), dst))
+        out.append((instant(year, end, dst), std))
+    out.sort()
+    # Offset before the first transition is whichever one it switches away from.
+    base = std if out[0][1] == dst else dst
+    return base, out
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--first", type=int, default=2026)
+    ap.add_argument("--last", type=int, default=2045)
+    ap.add_argument("rules")
+    ap.add_argument("output")
+    args = ap.parse_args()
+
+    zones = parse(args.rules)
+    rows, at, off = [], [], []
+    for zone in zones:
+        base, tr = transitions(zone, args.first, args.last)
+        rows.append((zone[0], zone[1], base // 900, len(at), len(tr)))
+        at += [t for t, _ in tr]
+        off += [o // 900 for _, o in tr]
+
+    with open(args.output, "w") as f:
+        w = f.write
+        w(f"// Generated by tools/tzgen.py from tools/zones.def ({args.first}-{args.last}).\n")
+        w("// Do not edit; change the rules and regenerate.\n\n")
+        w('#include "tz.h"\n\n')
+        w("const TzZone tz_zones[] = {\n")
+        for name, tag, base, first, count in rows:
+            w(f'    {{"{name}", "{tag}", {base}, {first}, {count}}},\n')
+        w("};\n\n")
+        w(f"const uint16_t tz_zone_count = {len(rows)};\n\n")
+        w(f"const uint32_t tz_at[] = {{\n")
+        for i in range(0, len(at), 6):
+            w("    " + " ".join(f"{t}UL," for t in at[i : i + 6]) + "\n")
+        w("};\n\n")
+        w(f"const int8_t tz_off[] = {{\n")
+        for i in range(0, len(off), 16):
+            w("    " + " ".join(f"{o}," for o in off[i : i + 16]) + "\n")
+        w("};\n")
+
+    print(
+        f"{args.output}: {len(rows)} zones, {len(at)} transitions, "
+        f"{len(at) * 5 + len(rows) * 12} bytes",
+        file=sys.stderr,
+    )
+
+
+if __name__ == "__main__":
+    main()
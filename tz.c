@@ -0,0 +1,109 @@
+#include "tz.h"
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <string.h>
+
+int tz_find(const char* name) {
+    for(int i = 0; i < tz_zone_count; i++) {
+        const char* a = tz_zones[i].name;
+        const char* b = name;
+        while(*a && tolower((unsigned char)*a) == tolower((unsigned char)*b)) {
+            a++;
+            b++;
+        }
+        if(!*a && !*b) return i;
+    }
+    return -1;
+}
+
+int32_t tz_offset(int zone, uint32_t utc, uint32_t* from, uint32_t* until) {
+    const TzZone* z = &tz_zones[zone];
+    const uint32_t* at = &tz_at[z->first];
+
+    // First transition after utc.
+    int lo = 0;
+    int hi = z->count;
+    while(lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if(at[mid] <= utc) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if(from) *from = lo ? at[lo - 1] : 0;
+    if(until) *until = (lo < z->count) ? at[lo] : TZ_NEVER;
+    return (lo ? tz_off[z->first + lo - 1] : z->base) * 900;
+}
+
+int world_config(WorldClock* wc, const char* text) {
+    memset(wc, 0, sizeof(*wc)); // empty window: the first tick looks everything up
+    wc->home = (int8_t)tz_find("UTC");
+    wc->minute = UINT32_MAX;
+
+    bool home = true;
+    while(*text) {
+        // One name per line, surrounding blanks and '#' comments ignored.
+        const char* end = text;
+        while(*end && *end != '\n') end++;
+
+        char name[16];
+        size_t n = 0;
+        for(const char* p = text; p < end && *p != '#'; p++) {
+            if(!isspace((unsigned char)*p) && n < sizeof(name) - 1) name[n++] = *p;
+        }
+        name[n] = '\0';
+        text = *end ? end + 1 : end;
+        if(!n) continue;
+
+        const int z = tz_find(name);
+        if(home) {
+            if(z >= 0) wc->home = (int8_t)z;
+            home = false;
+        } else if(z >= 0 && wc->count < WORLD_MAX) {
+            wc->zone[wc->count++] = (uint8_t)z;
+        }
+    }
+    return wc->count;
+}
+
+// Search the table for every zone, and narrow the window to where all of the
+// results hold.
+static void world_lookup(WorldClock* wc, uint32_t local) {
+    uint32_t from;
+    uint32_t until;
+
+    // The RTC gives local time; take the home offset as of local read as UTC,
+    // then look it up again at the UTC that gives. Only the repeated hour
+    // after a transition back can come out an hour off.
+    if(wc->home >= 0) {
+        const uint32_t guess = local - (uint32_t)tz_offset(wc->home, local, NULL, NULL);
+        wc->home_offset = tz_offset(wc->home, guess, &from, &until);
+        wc->lookups++;
+    } else {
+        wc->home_offset = 0;
+        from = 0;
+        until = TZ_NEVER;
+    }
+    const uint32_t utc = local - (uint32_t)wc->home_offset;
+    wc->valid_from = from;
+    wc->valid_until = until;
+
+    for(int i = 0; i < wc->count; i++) {
+        wc->offset[i] = tz_offset(wc->zone[i], utc, &from, &until);
+        if(from > wc->valid_from) wc->valid_from = from;
+        if(until < wc->valid_until) wc->valid_until = until;
+        wc->lookups++;
+    }
+}
+
+void world_tick(WorldClock* wc, uint32_t local) {
+    const uint32_t minute = local / 60;
+    if(minute == wc->minute) return;
+    wc->minute = minute;
+
+    const uint32_t utc = local - (uint32_t)wc->home_offset;
+    if(utc < wc->valid_from || utc >= wc->valid_until) world_lookup(wc, local);
+}
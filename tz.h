@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Time zones
+// ----------------------------------------------------------------------------
+//
+// The table in tzdata.c is generated on the host by tools/tzgen.py from the
+// rules in tools/zones.def: per zone, a run of UTC transition instants and the
+// offset in force after each one. Finding a zone's offset is a binary search
+// over its run. Plain C with no firmware dependencies, so the host benchmark
+// (tools/tzbench.c) builds the same code.
+//
+typedef struct {
+    const char* name;   // as used in zones.txt
+    char tag[3];        // two-character page label
+    int8_t base;        // offset before the first transition, 15-minute units
+    uint16_t first;     // first transition in tz_at / tz_off
+    uint16_t count;     // number of transitions
+} TzZone;
+
+extern const TzZone tz_zones[];
+extern const uint16_t tz_zone_count;
+extern const uint32_t tz_at[];   // transition instants, UTC seconds since 1970
+extern const int8_t tz_off[];    // offset from each transition on, 15-minute units
+
+#define TZ_NEVER UINT32_MAX
+
+// Zone index for a name (case-insensitive), or -1.
+int tz_find(const char* name);
+
+// Offset of zone at the UTC instant, in seconds. The offset holds for
+// [*from, *until); either pointer may be NULL. *from is 0 before the first
+// transition, *until TZ_NEVER after the last.
+int32_t tz_offset(int zone, uint32_t utc, uint32_t* from, uint32_t* until);
+
+// ----------------------------------------------------------------------------
+// World clock
+// ----------------------------------------------------------------------------
+//
+// The zones shown as pages, plus the zone the RTC is set to ("home"). The RTC
+// keeps local time, so a zone's time is local - home offset + zone offset.
+// Offsets are cached together with the window in which all of them hold;
+// world_tick runs once per minute and only searches the table again when the
+// clock leaves that window (a transition, or the RTC being set), so the
+// per-minute cost does not grow with the number of zones.
+//
+#define WORLD_MAX 32
+
+typedef struct {
+    int8_t home;                  // zone the RTC is set to
+    uint8_t count;                // zones shown
+    uint8_t zone[WORLD_MAX];
+    int32_t offset[WORLD_MAX];    // seconds, valid in [valid_from, valid_until)
+    int32_t home_offset;
+    uint32_t valid_from;          // UTC
+    uint32_t valid_until;         // UTC, TZ_NEVER if no transition ahead
+    uint32_t minute;              // local minute of the last tick
+    uint32_t lookups;             // perf: table searches done
+} WorldClock;
+
+// Parse a zones list: the first name is the home zone, the rest are shown.
+// One name per line, '#' starts a comment. Unknown names are skipped; a
+// missing home zone means UTC. Returns the number of zones shown.
+int world_config(WorldClock* wc, const char* text);
+
+// Bring the cached offsets up to date for the RTC's local timestamp. Cheap
+// unless the minute changed and a transition was crossed.
+void world_tick(WorldClock* wc, uint32_t local);
+
+// Local timestamp of shown zone i, given the RTC's local timestamp.
+static inline uint32_t world_time(const WorldClock* wc, int i, uint32_t local) {
+    return local - (uint32_t)wc->home_offset + (uint32_t)wc->offset[i];
+}
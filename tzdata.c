@@ -0,0 +1,208 @@
+// Generated by tools/tzgen.py from tools/zones.def (2026-2045).
+// Do not edit; change the rules and regenerate.
+
+#include "tz.h"
+
+const TzZone tz_zones[] = {
+    {"UTC", "UT", 0, 0, 0},
+    {"London", "LN", 0, 0, 40},
+    {"Dublin", "DB", 0, 40, 40},
+    {"Lisbon", "LS", 0, 80, 40},
+    {"Paris", "PA", 4, 120, 40},
+    {"Berlin", "BE", 4, 160, 40},
+    {"Athens", "AT", 8, 200, 40},
+    {"Helsinki", "HE", 8, 240, 40},
+    {"Lagos", "NG", 4, 280, 0},
+    {"Johannesburg", "ZA", 8, 280, 0},
+    {"Istanbul", "IS", 12, 280, 0},
+    {"Moscow", "MO", 12, 280, 0},
+    {"Tehran", "IR", 14, 280, 0},
+    {"Dubai", "DU", 16, 280, 0},
+    {"Karachi", "PK", 20, 280, 0},
+    {"Delhi", "IN", 22, 280, 0},
+    {"Kathmandu", "NP", 23, 280, 0},
+    {"Bangkok", "BK", 28, 280, 0},
+    {"Singapore", "SG", 32, 280, 0},
+    {"Shanghai", "CN", 32, 280, 0},
+    {"Tokyo", "TK", 36, 280, 0},
+    {"Seoul", "KR", 36, 280, 0},
+    {"Adelaide", "AD", 42, 280, 40},
+    {"Sydney", "SY", 44, 320, 40},
+    {"Auckland", "NZ", 52, 360, 40},
+    {"Honolulu", "HI", -40, 400, 0},
+    {"Anchorage", "AK", -36, 400, 40},
+    {"LosAngeles", "LA", -32, 440, 40},
+    {"Denver", "DE", -28, 480, 40},
+    {"Phoenix", "PH", -28, 520, 0},
+    {"Chicago", "CH", -24, 520, 40},
+    {"MexicoCity", "MX", -24, 560, 0},
+    {"NewYork", "NY", -20, 560, 40},
+    {"Halifax", "HX", -16, 600, 40},
+    {"StJohns", "NF", -14, 640, 40},
+    {"SaoPaulo", "SP", -12, 680, 0},
+};
+
+const uint16_t tz_zone_count = 36;
+
+const uint32_t tz_at[] = {
+    1774746000UL, 1792890000UL, 1806195600UL, 1824944400UL, 1837645200UL, 1856394000UL,
+    1869094800UL, 1887843600UL, 1901149200UL, 1919293200UL, 1932598800UL, 1950742800UL,
+    1964048400UL, 1982797200UL, 1995498000UL, 2014246800UL, 2026947600UL, 2045696400UL,
+    2058397200UL, 2077146000UL, 2090451600UL, 2108595600UL, 2121901200UL, 2140045200UL,
+    2153350800UL, 2172099600UL, 2184800400UL, 2203549200UL, 2216250000UL, 2234998800UL,
+    2248304400UL, 2266448400UL, 2279754000UL, 2297898000UL, 2311203600UL, 2329347600UL,
+    2342653200UL, 2361402000UL, 2374102800UL, 2392851600UL, 1774746000UL, 1792890000UL,
+    1806195600UL, 1824944400UL, 1837645200UL, 1856394000UL, 1869094800UL, 1887843600UL,
+    1901149200UL, 1919293200UL, 1932598800UL, 1950742800UL, 1964048400UL, 1982797200UL,
+    1995498000UL, 2014246800UL, 2026947600UL, 2045696400UL, 2058397200UL, 2077146000UL,
+    2090451600UL, 2108595600UL, 2121901200UL, 2140045200UL, 2153350800UL, 2172099600UL,
+    2184800400UL, 2203549200UL, 2216250000UL, 2234998800UL, 2248304400UL, 2266448400UL,
+    2279754000UL, 2297898000UL, 2311203600UL, 2329347600UL, 2342653200UL, 2361402000UL,
+    2374102800UL, 2392851600UL, 1774746000UL, 1792890000UL, 1806195600UL, 1824944400UL,
+    1837645200UL, 1856394000UL, 1869094800UL, 1887843600UL, 1901149200UL, 1919293200UL,
+    1932598800UL, 1950742800UL, 1964048400UL, 1982797200UL, 1995498000UL, 2014246800UL,
+    2026947600UL, 2045696400UL, 2058397200UL, 2077146000UL, 2090451600UL, 2108595600UL,
+    2121901200UL, 2140045200UL, 2153350800UL, 2172099600UL, 2184800400UL, 2203549200UL,
+    2216250000UL, 2234998800UL, 2248304400UL, 2266448400UL, 2279754000UL, 2297898000UL,
+    2311203600UL, 2329347600UL, 2342653200UL, 2361402000UL, 2374102800UL, 2392851600UL,
+    1774746000UL, 1792890000UL, 1806195600UL, 1824944400UL, 1837645200UL, 1856394000UL,
+    1869094800UL, 1887843600UL, 1901149200UL, 1919293200UL, 1932598800UL, 1950742800UL,
+    1964048400UL, 1982797200UL, 1995498000UL, 2014246800UL, 2026947600UL, 2045696400UL,
+    2058397200UL, 2077146000UL, 2090451600UL, 2108595600UL, 2121901200UL, 2140045200UL,
+    2153350800UL, 2172099600UL, 2184800400UL, 2203549200UL, 2216250000UL, 2234998800UL,
+    2248304400UL, 2266448400UL, 2279754000UL, 2297898000UL, 2311203600UL, 2329347600UL,
+    2342653200UL, 2361402000UL, 2374102800UL, 2392851600UL, 1774746000UL, 1792890000UL,
+    1806195600UL, 1824944400UL, 1837645200UL, 1856394000UL, 1869094800UL, 1887843600UL,
+    1901149200UL, 1919293200UL, 1932598800UL, 1950742800UL, 1964048400UL, 1982797200UL,
+    1995498000UL, 2014246800UL, 2026947600UL, 2045696400UL, 2058397200UL, 2077146000UL,
+    2090451600UL, 2108595600UL, 2121901200UL, 2140045200UL, 2153350800UL, 2172099600UL,
+    2184800400UL, 2203549200UL, 2216250000UL, 2234998800UL, 2248304400UL, 2266448400UL,
+    2279754000UL, 2297898000UL, 2311203600UL, 2329347600UL, 2342653200UL, 2361402000UL,
+    2374102800UL, 2392851600UL, 1774746000UL, 1792890000UL, 1806195600UL, 1824944400UL,
+    1837645200UL, 1856394000UL, 1869094800UL, 1887843600UL, 1901149200UL, 1919293200UL,
+    1932598800UL, 1950742800UL, 1964048400UL, 1982797200UL, 1995498000UL, 2014246800UL,
+    2026947600UL, 2045696400UL, 2058397200UL, 2077146000UL, 2090451600UL, 2108595600UL,
+    2121901200UL, 2140045200UL, 2153350800UL, 2172099600UL, 2184800400UL, 2203549200UL,
+    2216250000UL, 2234998800UL, 2248304400UL, 2266448400UL, 2279754000UL, 2297898000UL,
+    2311203600UL, 2329347600UL, 2342653200UL, 2361402000UL, 2374102800UL, 2392851600UL,
+    1774746000UL, 1792890000UL, 1806195600UL, 1824944400UL, 1837645200UL, 1856394000UL,
+    1869094800UL, 1887843600UL, 1901149200UL, 1919293200UL, 1932598800UL, 1950742800UL,
+    1964048400UL, 1982797200UL, 1995498000UL, 2014246800UL, 2026947600UL, 2045696400UL,
+    2058397200UL, 2077146000UL, 2090451600UL, 2108595600UL, 2121901200UL, 2140045200UL,
+    2153350800UL, 2172099600UL, 2184800400UL, 2203549200UL, 2216250000UL, 2234998800UL,
+    2248304400UL, 2266448400UL, 2279754000UL, 2297898000UL, 2311203600UL, 2329347600UL,
+    2342653200UL, 2361402000UL, 2374102800UL, 2392851600UL, 1775320200UL, 1791045000UL,
+    1806769800UL, 1822494600UL, 1838219400UL, 1853944200UL, 1869669000UL, 1885998600UL,
+    1901723400UL, 1917448200UL, 1933173000UL, 1948897800UL, 1964622600UL, 1980347400UL,
+    1996072200UL, 2011797000UL, 2027521800UL, 2043246600UL, 2058971400UL, 2075301000UL,
+    2091025800UL, 2106750600UL, 2122475400UL, 2138200200UL, 2153925000UL, 2169649800UL,
+    2185374600UL, 2201099400UL, 2216824200UL, 2233153800UL, 2248878600UL, 2264603400UL,
+    2280328200UL, 2296053000UL, 2311777800UL, 2327502600UL, 2343227400UL, 2358952200UL,
+    2374677000UL, 2390401800UL, 1775318400UL, 1791043200UL, 1806768000UL, 1822492800UL,
+    1838217600UL, 1853942400UL, 1869667200UL, 1885996800UL, 1901721600UL, 1917446400UL,
+    1933171200UL, 1948896000UL, 1964620800UL, 1980345600UL, 1996070400UL, 2011795200UL,
+    2027520000UL, 2043244800UL, 2058969600UL, 2075299200UL, 2091024000UL, 2106748800UL,
+    2122473600UL, 2138198400UL, 2153923200UL, 2169648000UL, 2185372800UL, 2201097600UL,
+    2216822400UL, 2233152000UL, 2248876800UL, 2264601600UL, 2280326400UL, 2296051200UL,
+    2311776000UL, 2327500800UL, 2343225600UL, 2358950400UL, 2374675200UL, 2390400000UL,
+    1775311200UL, 1790431200UL, 1806760800UL, 1821880800UL, 1838210400UL, 1853330400UL,
+    1869660000UL, 1885384800UL, 1901714400UL, 1916834400UL, 1933164000UL, 1948284000UL,
+    1964613600UL, 1979733600UL, 1996063200UL, 2011183200UL, 2027512800UL, 2042632800UL,
+    2058962400UL, 2074687200UL, 2091016800UL, 2106136800UL, 2122466400UL, 2137586400UL,
+    2153916000UL, 2169036000UL, 2185365600UL, 2200485600UL, 2216815200UL, 2232540000UL,
+    2248869600UL, 2263989600UL, 2280319200UL, 2295439200UL, 2311768800UL, 2326888800UL,
+    2343218400UL, 2358338400UL, 2374668000UL, 2389788000UL, 1772967600UL, 1793527200UL,
+    1805022000UL, 1825581600UL, 1836471600UL, 1857031200UL, 1867921200UL, 1888480800UL,
+    1899370800UL, 1919930400UL, 1930820400UL, 1951380000UL, 1962874800UL, 1983434400UL,
+    1994324400UL, 2014884000UL, 2025774000UL, 2046333600UL, 2057223600UL, 2077783200UL,
+    2088673200UL, 2109232800UL, 2120122800UL, 2140682400UL, 2152177200UL, 2172736800UL,
+    2183626800UL, 2204186400UL, 2215076400UL, 2235636000UL, 2246526000UL, 2267085600UL,
+    2277975600UL, 2298535200UL, 2309425200UL, 2329984800UL, 2341479600UL, 2362039200UL,
+    2372929200UL, 2393488800UL, 1772964000UL, 1793523600UL, 1805018400UL, 1825578000UL,
+    1836468000UL, 1857027600UL, 1867917600UL, 1888477200UL, 1899367200UL, 1919926800UL,
+    1930816800UL, 1951376400UL, 1962871200UL, 1983430800UL, 1994320800UL, 2014880400UL,
+    2025770400UL, 2046330000UL, 2057220000UL, 2077779600UL, 2088669600UL, 2109229200UL,
+    2120119200UL, 2140678800UL, 2152173600UL, 2172733200UL, 2183623200UL, 2204182800UL,
+    2215072800UL, 2235632400UL, 2246522400UL, 2267082000UL, 2277972000UL, 2298531600UL,
+    2309421600UL, 2329981200UL, 2341476000UL, 2362035600UL, 2372925600UL, 2393485200UL,
+    1772960400UL, 1793520000UL, 1805014800UL, 1825574400UL, 1836464400UL, 1857024000UL,
+    1867914000UL, 1888473600UL, 1899363600UL, 1919923200UL, 1930813200UL, 1951372800UL,
+    1962867600UL, 1983427200UL, 1994317200UL, 2014876800UL, 2025766800UL, 2046326400UL,
+    2057216400UL, 2077776000UL, 2088666000UL, 2109225600UL, 2120115600UL, 2140675200UL,
+    2152170000UL, 2172729600UL, 2183619600UL, 2204179200UL, 2215069200UL, 2235628800UL,
+    2246518800UL, 2267078400UL, 2277968400UL, 2298528000UL, 2309418000UL, 2329977600UL,
+    2341472400UL, 2362032000UL, 2372922000UL, 2393481600UL, 1772956800UL, 1793516400UL,
+    1805011200UL, 1825570800UL, 1836460800UL, 1857020400UL, 1867910400UL, 1888470000UL,
+    1899360000UL, 1919919600UL, 1930809600UL, 1951369200UL, 1962864000UL, 1983423600UL,
+    1994313600UL, 2014873200UL, 2025763200UL, 2046322800UL, 2057212800UL, 2077772400UL,
+    2088662400UL, 2109222000UL, 2120112000UL, 2140671600UL, 2152166400UL, 2172726000UL,
+    2183616000UL, 2204175600UL, 2215065600UL, 2235625200UL, 2246515200UL, 2267074800UL,
+    2277964800UL, 2298524400UL, 2309414400UL, 2329974000UL, 2341468800UL, 2362028400UL,
+    2372918400UL, 2393478000UL, 1772953200UL, 1793512800UL, 1805007600UL, 1825567200UL,
+    1836457200UL, 1857016800UL, 1867906800UL, 1888466400UL, 1899356400UL, 1919916000UL,
+    1930806000UL, 1951365600UL, 1962860400UL, 1983420000UL, 1994310000UL, 2014869600UL,
+    2025759600UL, 2046319200UL, 2057209200UL, 2077768800UL, 2088658800UL, 2109218400UL,
+    2120108400UL, 2140668000UL, 2152162800UL, 2172722400UL, 2183612400UL, 2204172000UL,
+    2215062000UL, 2235621600UL, 2246511600UL, 2267071200UL, 2277961200UL, 2298520800UL,
+    2309410800UL, 2329970400UL, 2341465200UL, 2362024800UL, 2372914800UL, 2393474400UL,
+    1772949600UL, 1793509200UL, 1805004000UL, 1825563600UL, 1836453600UL, 1857013200UL,
+    1867903200UL, 1888462800UL, 1899352800UL, 1919912400UL, 1930802400UL, 1951362000UL,
+    1962856800UL, 1983416400UL, 1994306400UL, 2014866000UL, 2025756000UL, 2046315600UL,
+    2057205600UL, 2077765200UL, 2088655200UL, 2109214800UL, 2120104800UL, 2140664400UL,
+    2152159200UL, 2172718800UL, 2183608800UL, 2204168400UL, 2215058400UL, 2235618000UL,
+    2246508000UL, 2267067600UL, 2277957600UL, 2298517200UL, 2309407200UL, 2329966800UL,
+    2341461600UL, 2362021200UL, 2372911200UL, 2393470800UL, 1772947800UL, 1793507400UL,
+    1805002200UL, 1825561800UL, 1836451800UL, 1857011400UL, 1867901400UL, 1888461000UL,
+    1899351000UL, 1919910600UL, 1930800600UL, 1951360200UL, 1962855000UL, 1983414600UL,
+    1994304600UL, 2014864200UL, 2025754200UL, 2046313800UL, 2057203800UL, 2077763400UL,
+    2088653400UL, 2109213000UL, 2120103000UL, 2140662600UL, 2152157400UL, 2172717000UL,
+    2183607000UL, 2204166600UL, 2215056600UL, 2235616200UL, 2246506200UL, 2267065800UL,
+    2277955800UL, 2298515400UL, 2309405400UL, 2329965000UL, 2341459800UL, 2362019400UL,
+    2372909400UL, 2393469000UL,
+};
+
+const int8_t tz_off[] = {
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 12, 8, 12, 8, 12, 8, 12, 8,
+    12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8,
+    12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8,
+    12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8,
+    12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8, 12, 8,
+    12, 8, 12, 8, 12, 8, 12, 8, 38, 42, 38, 42, 38, 42, 38, 42,
+    38, 42, 38, 42, 38, 42, 38, 42, 38, 42, 38, 42, 38, 42, 38, 42,
+    38, 42, 38, 42, 38, 42, 38, 42, 38, 42, 38, 42, 38, 42, 38, 42,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    40, 44, 40, 44, 40, 44, 40, 44, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,
+    -32, -36, -32, -36, -32, -36, -32, -36, -32, -36, -32, -36, -32, -36, -32, -36,
+    -32, -36, -32, -36, -32, -36, -32, -36, -32, -36, -32, -36, -32, -36, -32, -36,
+    -32, -36, -32, -36, -32, -36, -32, -36, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -24, -28, -24, -28, -24, -28, -24, -28, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20, -16, -20, -16, -20, -16, -20, -12, -16, -12, -16, -12, -16, -12, -16,
+    -12, -16, -12, -16, -12, -16, -12, -16, -12, -16, -12, -16, -12, -16, -12, -16,
+    -12, -16, -12, -16, -12, -16, -12, -16, -12, -16, -12, -16, -12, -16, -12, -16,
+    -10, -14, -10, -14, -10, -14, -10, -14, -10, -14, -10, -14, -10, -14, -10, -14,
+    -10, -14, -10, -14, -10, -14, -10, -14, -10, -14, -10, -14, -10, -14, -10, -14,
+    -10, -14, -10, -14, -10, -14, -10, -14,
+};